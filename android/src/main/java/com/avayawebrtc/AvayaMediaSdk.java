@@ -0,0 +1,283 @@
+package com.avayawebrtc;
+
+import android.app.Application;
+import android.os.Handler;
+import android.os.Looper;
+import android.util.Log;
+
+import com.avaya.ocs.Config.ClientConfiguration;
+import com.avaya.ocs.Config.WebGatewayConfiguration;
+import com.avaya.ocs.OceanaCustomerWebVoiceVideo;
+import com.avaya.ocs.Services.Device.Video.Enums.CallQuality;
+import com.avaya.ocs.Services.Work.Enums.AudioDeviceError;
+import com.avaya.ocs.Services.Work.Enums.AudioDeviceType;
+import com.avaya.ocs.Services.Work.Enums.DTMFTone;
+import com.avaya.ocs.Services.Work.Enums.InteractionError;
+import com.avaya.ocs.Services.Work.Enums.PlatformType;
+import com.avaya.ocs.Services.Work.Interactions.AudioInteraction;
+import com.avaya.ocs.Services.Work.Interactions.Listeners.AudioInteractionListener;
+import com.avaya.ocs.Services.Work.Interactions.Listeners.OnAudioDeviceChangeListener;
+import com.avaya.ocs.Services.Work.Work;
+
+import java.util.List;
+
+/**
+ * The Java half of the native `AndroidMediaSdk`, which the shared C++
+ * `CallSession` drives. Runs the commands on the main looper, where the SDK
+ * must be used, and reports the call progress back to native code.
+ *
+ * Only audio calls are supported.
+ */
+final class AvayaMediaSdk {
+
+    private static final String TAG = "AvayaMediaSdk";
+    private static final String DEFAULT_GATEWAY_ADDRESS = "sipsignal.whnmandiri.co.id";
+    private static final int DEFAULT_GATEWAY_PORT = 443;
+
+    // Match the `Progress` values of AndroidMediaSdk.cpp.
+    private static final int PROGRESS_INITIATING = 0;
+    private static final int PROGRESS_REMOTE_ALERTING = 1;
+    private static final int PROGRESS_ACTIVE = 2;
+    private static final int PROGRESS_ENDED = 3;
+    private static final int PROGRESS_FAILED = 4;
+
+    // In the order of the native `DtmfTone`.
+    private static final DTMFTone[] DTMF_TONES = {
+        DTMFTone.ZERO, DTMFTone.ONE, DTMFTone.TWO, DTMFTone.THREE,
+        DTMFTone.FOUR, DTMFTone.FIVE, DTMFTone.SIX, DTMFTone.SEVEN,
+        DTMFTone.EIGHT, DTMFTone.NINE, DTMFTone.STAR, DTMFTone.POUND,
+    };
+
+    private static volatile Application application;
+
+    private final Handler mainHandler = new Handler(Looper.getMainLooper());
+
+    // The native `AndroidMediaSdk`, or 0 once it is gone. Guarded by `this`.
+    private long nativeHandle;
+
+    // Only used on the main looper.
+    private OceanaCustomerWebVoiceVideo sdk;
+    private String token;
+    // Written on the main looper, read by the SDK's callbacks.
+    private volatile AudioInteraction audioInteraction;
+
+    /** Sets the context calls are made in. */
+    static void setApplication(Application app) {
+        application = app;
+    }
+
+    static String getVersionNumber() {
+        return new OceanaCustomerWebVoiceVideo(new ClientConfiguration()).getVersionNumber();
+    }
+
+    // Called from native code.
+    AvayaMediaSdk(long nativeHandle) {
+        this.nativeHandle = nativeHandle;
+    }
+
+    // Called from native code.
+    void configure(String token, String address, String port, String urlPath) {
+        final String gatewayAddress = address.isEmpty() ? DEFAULT_GATEWAY_ADDRESS : address;
+        final int gatewayPort = port.isEmpty() ? DEFAULT_GATEWAY_PORT : Integer.parseInt(port);
+        mainHandler.post(() -> {
+            this.sdk = null;
+            this.token = token;
+            try {
+                WebGatewayConfiguration webGatewayConfig = new WebGatewayConfiguration();
+                webGatewayConfig.setWebGatewayAddress(gatewayAddress);
+                webGatewayConfig.setPort(gatewayPort);
+                webGatewayConfig.setSecure(true);
+
+                ClientConfiguration clientConfig = new ClientConfiguration();
+                clientConfig.setWebGatewayConfiguration(webGatewayConfig);
+                sdk = new OceanaCustomerWebVoiceVideo(clientConfig);
+                sdk.registerLogger(java.util.logging.Level.FINE);
+            } catch (Exception e) {
+                Log.e(TAG, "Cannot configure the SDK", e);
+            }
+        });
+    }
+
+    // Called from native code.
+    void startCall(boolean video, String destination) {
+        if (video) {
+            throw new UnsupportedOperationException("Video calls are not supported on Android");
+        }
+        final Application app = application;
+        if (app == null) {
+            throw new IllegalStateException("No application context");
+        }
+        mainHandler.post(() -> {
+            audioInteraction = null;
+            try {
+                if (sdk == null) {
+                    throw new IllegalStateException("The SDK is not configured");
+                }
+                Work work = sdk.createWork();
+                AudioInteraction interaction = work.createAudioInteraction(app, audioDeviceListener);
+                interaction.setPlatformType(PlatformType.ELITE);
+                interaction.setAuthorizationToken(token);
+                interaction.setDestinationAddress(destination);
+                interaction.registerListener(new InteractionListener(interaction));
+                audioInteraction = interaction;
+                interaction.start();
+            } catch (Exception e) {
+                Log.e(TAG, "Cannot start the call", e);
+                audioInteraction = null;
+                dispatchProgress(PROGRESS_FAILED, e.toString());
+            }
+        });
+    }
+
+    // Called from native code.
+    void endCall() {
+        mainHandler.post(() -> {
+            AudioInteraction interaction = audioInteraction;
+            if (interaction == null) {
+                // The call never got an interaction, so nothing else will end it.
+                dispatchProgress(PROGRESS_ENDED, null);
+                return;
+            }
+            try {
+                interaction.end();
+            } catch (Exception e) {
+                Log.e(TAG, "Cannot end the call", e);
+            }
+        });
+    }
+
+    // Called from native code.
+    void setAudioMuted(boolean muted) {
+        mainHandler.post(() -> {
+            AudioInteraction interaction = audioInteraction;
+            try {
+                if (interaction != null) {
+                    interaction.muteAudio(muted);
+                }
+            } catch (Exception e) {
+                Log.e(TAG, "Cannot mute the call", e);
+            }
+        });
+    }
+
+    // Called from native code.
+    void setVideoEnabled(boolean enabled) {
+        throw new UnsupportedOperationException("Video calls are not supported on Android");
+    }
+
+    // Called from native code.
+    void selectCamera(boolean front) {
+        throw new UnsupportedOperationException("Video calls are not supported on Android");
+    }
+
+    // Called from native code.
+    void sendDtmf(int tone) {
+        if (tone < 0 || tone >= DTMF_TONES.length) {
+            throw new IllegalArgumentException("Unsupported DTMF tone: " + tone);
+        }
+        final DTMFTone dtmfTone = DTMF_TONES[tone];
+        mainHandler.post(() -> {
+            AudioInteraction interaction = audioInteraction;
+            try {
+                if (interaction != null) {
+                    interaction.sendDtmf(dtmfTone);
+                }
+            } catch (Exception e) {
+                Log.e(TAG, "Cannot send DTMF", e);
+            }
+        });
+    }
+
+    /**
+     * Called from the native destructor. Waits for the callback in progress,
+     * and drops the later ones.
+     */
+    synchronized void detach() {
+        nativeHandle = 0;
+    }
+
+    private synchronized void dispatchProgress(int progress, String error) {
+        if (nativeHandle != 0) {
+            nativeOnProgress(nativeHandle, progress, error);
+        }
+    }
+
+    private synchronized void dispatchQuality(CallQuality quality) {
+        if (nativeHandle != 0) {
+            nativeOnQuality(nativeHandle, quality == null ? null : quality.name());
+        }
+    }
+
+    private final OnAudioDeviceChangeListener audioDeviceListener = new OnAudioDeviceChangeListener() {
+        @Override public void onAudioDeviceListChanged(List<AudioDeviceType> deviceList) {}
+        @Override public void onAudioDeviceChanged(AudioDeviceType newDevice) {}
+        @Override public void onAudioDeviceError(AudioDeviceError error) {}
+    };
+
+    /** Forwards the callbacks of one interaction while it is the current one. */
+    private final class InteractionListener implements AudioInteractionListener {
+
+        private final AudioInteraction interaction;
+
+        InteractionListener(AudioInteraction interaction) {
+            this.interaction = interaction;
+        }
+
+        private boolean isCurrent() {
+            return interaction == audioInteraction;
+        }
+
+        @Override
+        public void onInteractionInitiating() {
+            if (isCurrent()) {
+                dispatchProgress(PROGRESS_INITIATING, null);
+            }
+        }
+
+        @Override
+        public void onInteractionRemoteAlerting() {
+            if (isCurrent()) {
+                dispatchProgress(PROGRESS_REMOTE_ALERTING, null);
+            }
+        }
+
+        @Override
+        public void onInteractionActive() {
+            if (isCurrent()) {
+                dispatchProgress(PROGRESS_ACTIVE, null);
+            }
+        }
+
+        @Override
+        public void onInteractionEnded() {
+            if (isCurrent()) {
+                dispatchProgress(PROGRESS_ENDED, null);
+            }
+        }
+
+        @Override
+        public void onInteractionFailed(InteractionError error) {
+            if (isCurrent()) {
+                dispatchProgress(PROGRESS_FAILED, String.valueOf(error));
+            }
+        }
+
+        @Override
+        public void onInteractionQualityChanged(CallQuality quality) {
+            if (isCurrent()) {
+                dispatchQuality(quality);
+            }
+        }
+
+        @Override public void onInteractionAudioMuteStatusChanged(boolean muted) {}
+        @Override public void onInteractionHeld() {}
+        @Override public void onInteractionUnheld() {}
+        @Override public void onInteractionHeldRemotely() {}
+        @Override public void onInteractionUnheldRemotely() {}
+        @Override public void onDiscardComplete() {}
+    }
+
+    private static native void nativeOnProgress(long handle, int progress, String error);
+
+    private static native void nativeOnQuality(long handle, String quality);
+}
@@ -0,0 +1,104 @@
+package com.avayawebrtc;
+
+import androidx.annotation.Nullable;
+
+import com.facebook.soloader.SoLoader;
+
+/**
+ * The shared C++ call session, which owns the call state on both platforms.
+ * Commands throw a `CallSessionException` when the session refuses them.
+ */
+final class CallSession {
+
+    static {
+        // Also registers the Android SDK for the `CallSession` TurboModule.
+        SoLoader.loadLibrary("avayawebrtc_callsession");
+    }
+
+    interface Listener {
+        /**
+         * Called on whichever thread changed the call. `status` is the
+         * "onCallStateChanged" status of the state, if it has one.
+         */
+        void onStateChanged(String state, @Nullable String status, @Nullable String error);
+    }
+
+    private final Listener listener;
+    // The native session, or 0 once closed. Guarded by `this`.
+    private long nativeHandle;
+
+    CallSession(Listener listener) {
+        this.listener = listener;
+        this.nativeHandle = nativeCreate();
+    }
+
+    synchronized void configure(String token, String address, String port, String urlPath) {
+        nativeConfigure(handle(), token, address, port, urlPath);
+    }
+
+    synchronized void startCall(boolean video, String destination) {
+        nativeStartCall(handle(), video, destination);
+    }
+
+    /** Returns false if there is no call to end. */
+    synchronized boolean endCall() {
+        return nativeEndCall(handle());
+    }
+
+    synchronized void setAudioMuted(boolean muted) {
+        nativeSetAudioMuted(handle(), muted);
+    }
+
+    synchronized void setVideoEnabled(boolean enabled) {
+        nativeSetVideoEnabled(handle(), enabled);
+    }
+
+    /** Returns the camera now in use, "front" or "back". */
+    synchronized String switchCamera() {
+        return nativeSwitchCamera(handle());
+    }
+
+    synchronized void sendDtmf(String digit) {
+        nativeSendDtmf(handle(), digit);
+    }
+
+    /** Detaches from the SDK. Later commands throw. */
+    synchronized void close() {
+        if (nativeHandle != 0) {
+            nativeDestroy(nativeHandle);
+            nativeHandle = 0;
+        }
+    }
+
+    private long handle() {
+        if (nativeHandle == 0) {
+            throw new CallSessionException("closed", "The call session is closed");
+        }
+        return nativeHandle;
+    }
+
+    // Called from native code. Not synchronized, as it may run during a
+    // command or `close()`.
+    private void onNativeEvent(String state, @Nullable String status, @Nullable String error) {
+        listener.onStateChanged(state, status, error);
+    }
+
+    private native long nativeCreate();
+
+    private static native void nativeDestroy(long handle);
+
+    private static native void nativeConfigure(
+            long handle, String token, String address, String port, String urlPath);
+
+    private static native void nativeStartCall(long handle, boolean video, String destination);
+
+    private static native boolean nativeEndCall(long handle);
+
+    private static native void nativeSetAudioMuted(long handle, boolean muted);
+
+    private static native void nativeSetVideoEnabled(long handle, boolean enabled);
+
+    private static native String nativeSwitchCamera(long handle);
+
+    private static native void nativeSendDtmf(long handle, String digit);
+}
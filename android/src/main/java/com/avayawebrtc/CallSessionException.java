@@ -0,0 +1,20 @@
+package com.avayawebrtc;
+
+/**
+ * A command the shared call session refused. `getCode()` is the promise
+ * rejection code ("no_config", "no_call", ...), the same on iOS.
+ */
+public class CallSessionException extends RuntimeException {
+
+    private final String code;
+
+    // Called from native code.
+    CallSessionException(String code, String message) {
+        super(message);
+        this.code = code;
+    }
+
+    public String getCode() {
+        return code;
+    }
+}
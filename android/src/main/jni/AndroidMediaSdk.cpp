@@ -0,0 +1,236 @@
+#include "AndroidMediaSdk.h"
+
+#include <string_view>
+
+#include "JniUtils.h"
+
+namespace avayawebrtc {
+
+namespace {
+
+// Matches the `PROGRESS_*` constants of `AvayaMediaSdk.java`.
+enum Progress : jint {
+  Initiating = 0,
+  RemoteAlerting = 1,
+  Active = 2,
+  Ended = 3,
+  Failed = 4,
+};
+
+struct JavaPeer {
+  jclass peerClass;
+  jmethodID constructor;
+  jmethodID configure;
+  jmethodID startCall;
+  jmethodID endCall;
+  jmethodID setAudioMuted;
+  jmethodID setVideoEnabled;
+  jmethodID selectCamera;
+  jmethodID sendDtmf;
+  jmethodID detach;
+};
+
+JavaPeer javaPeer;
+
+CallQuality toCallQuality(std::string_view quality) {
+  if (quality == "BAD") {
+    return CallQuality::Bad;
+  }
+  if (quality == "POOR") {
+    return CallQuality::Poor;
+  }
+  if (quality == "FAIR") {
+    return CallQuality::Fair;
+  }
+  if (quality == "GOOD") {
+    return CallQuality::Good;
+  }
+  if (quality == "EXCELLENT") {
+    return CallQuality::Excellent;
+  }
+  return CallQuality::Unknown;
+}
+
+// Calls a `void` method of the Java peer, rethrowing its exception.
+template <typename... Args>
+void callPeer(jobject peer, jmethodID method, Args... args) {
+  auto env = currentEnv();
+  env->CallVoidMethod(peer, method, args...);
+  rethrowJavaException(env);
+}
+
+// A local reference to a new Java string, deleted when it goes out of scope.
+class JavaString {
+ public:
+  JavaString(JNIEnv* env, const std::string& string)
+      : env_(env), string_(env->NewStringUTF(string.c_str())) {}
+
+  ~JavaString() {
+    env_->DeleteLocalRef(string_);
+  }
+
+  JavaString(const JavaString&) = delete;
+  JavaString& operator=(const JavaString&) = delete;
+
+  operator jstring() const {
+    return string_;
+  }
+
+ private:
+  JNIEnv* env_;
+  jstring string_;
+};
+
+} // namespace
+
+AndroidMediaSdk::AndroidMediaSdk() {
+  auto env = currentEnv();
+  auto peer = env->NewObject(
+      javaPeer.peerClass,
+      javaPeer.constructor,
+      reinterpret_cast<jlong>(this));
+  rethrowJavaException(env);
+  peer_ = env->NewGlobalRef(peer);
+  env->DeleteLocalRef(peer);
+}
+
+AndroidMediaSdk::~AndroidMediaSdk() {
+  // Waits for the callback the peer may be delivering to `this`.
+  auto env = currentEnv();
+  env->CallVoidMethod(peer_, javaPeer.detach);
+  env->ExceptionClear();
+  env->DeleteGlobalRef(peer_);
+}
+
+void AndroidMediaSdk::setListener(MediaSdkListener* listener) {
+  std::lock_guard lock(listenerMutex_);
+  listener_ = listener;
+}
+
+void AndroidMediaSdk::configure(const MediaSdkConfiguration& configuration) {
+  auto env = currentEnv();
+  callPeer(
+      peer_,
+      javaPeer.configure,
+      static_cast<jstring>(JavaString(env, configuration.token)),
+      static_cast<jstring>(JavaString(env, configuration.gatewayAddress)),
+      static_cast<jstring>(JavaString(env, configuration.gatewayPort)),
+      static_cast<jstring>(JavaString(env, configuration.gatewayUrlPath)));
+}
+
+void AndroidMediaSdk::startCall(
+    CallMedia media,
+    const std::string& destination) {
+  auto env = currentEnv();
+  callPeer(
+      peer_,
+      javaPeer.startCall,
+      static_cast<jboolean>(media == CallMedia::Video),
+      static_cast<jstring>(JavaString(env, destination)));
+}
+
+void AndroidMediaSdk::endCall() {
+  callPeer(peer_, javaPeer.endCall);
+}
+
+void AndroidMediaSdk::setAudioMuted(bool muted) {
+  callPeer(peer_, javaPeer.setAudioMuted, static_cast<jboolean>(muted));
+}
+
+void AndroidMediaSdk::setVideoEnabled(bool enabled) {
+  callPeer(peer_, javaPeer.setVideoEnabled, static_cast<jboolean>(enabled));
+}
+
+void AndroidMediaSdk::selectCamera(Camera camera) {
+  callPeer(
+      peer_,
+      javaPeer.selectCamera,
+      static_cast<jboolean>(camera == Camera::Front));
+}
+
+void AndroidMediaSdk::sendDtmf(DtmfTone tone) {
+  callPeer(peer_, javaPeer.sendDtmf, static_cast<jint>(tone));
+}
+
+template <typename Callback>
+void AndroidMediaSdk::notify(Callback&& callback) {
+  std::lock_guard lock(listenerMutex_);
+  if (listener_) {
+    callback(*listener_);
+  }
+}
+
+void AndroidMediaSdk::onProgress(
+    JNIEnv* env,
+    jclass,
+    jlong handle,
+    jint progress,
+    jstring error) {
+  auto& sdk = *reinterpret_cast<AndroidMediaSdk*>(handle);
+  auto description = toStdString(env, error);
+  sdk.notify([&](MediaSdkListener& listener) {
+    switch (progress) {
+      case Progress::Initiating:
+        listener.onInitiating();
+        break;
+      case Progress::RemoteAlerting:
+        listener.onRemoteAlerting();
+        break;
+      case Progress::Active:
+        listener.onActive();
+        break;
+      case Progress::Ended:
+        listener.onEnded();
+        break;
+      case Progress::Failed:
+        listener.onFailed(description);
+        break;
+      default:
+        break;
+    }
+  });
+}
+
+void AndroidMediaSdk::onQuality(
+    JNIEnv* env,
+    jclass,
+    jlong handle,
+    jstring quality) {
+  auto& sdk = *reinterpret_cast<AndroidMediaSdk*>(handle);
+  CallStats stats{.quality = toCallQuality(toStdString(env, quality))};
+  sdk.notify([&](MediaSdkListener& listener) { listener.onStats(stats); });
+}
+
+void AndroidMediaSdk::registerNatives(JNIEnv* env) {
+  auto peerClass = findGlobalClass(env, "com/avayawebrtc/AvayaMediaSdk");
+  javaPeer = JavaPeer{
+      .peerClass = peerClass,
+      .constructor = env->GetMethodID(peerClass, "<init>", "(J)V"),
+      .configure = env->GetMethodID(
+          peerClass,
+          "configure",
+          "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;"
+          "Ljava/lang/String;)V"),
+      .startCall =
+          env->GetMethodID(peerClass, "startCall", "(ZLjava/lang/String;)V"),
+      .endCall = env->GetMethodID(peerClass, "endCall", "()V"),
+      .setAudioMuted = env->GetMethodID(peerClass, "setAudioMuted", "(Z)V"),
+      .setVideoEnabled =
+          env->GetMethodID(peerClass, "setVideoEnabled", "(Z)V"),
+      .selectCamera = env->GetMethodID(peerClass, "selectCamera", "(Z)V"),
+      .sendDtmf = env->GetMethodID(peerClass, "sendDtmf", "(I)V"),
+      .detach = env->GetMethodID(peerClass, "detach", "()V")};
+
+  const JNINativeMethod methods[] = {
+      {const_cast<char*>("nativeOnProgress"),
+       const_cast<char*>("(JILjava/lang/String;)V"),
+       reinterpret_cast<void*>(&AndroidMediaSdk::onProgress)},
+      {const_cast<char*>("nativeOnQuality"),
+       const_cast<char*>("(JLjava/lang/String;)V"),
+       reinterpret_cast<void*>(&AndroidMediaSdk::onQuality)},
+  };
+  env->RegisterNatives(
+      peerClass, methods, sizeof(methods) / sizeof(methods[0]));
+}
+
+} // namespace avayawebrtc
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <jni.h>
+
+#include <mutex>
+
+#include "MediaSdk.h"
+
+namespace avayawebrtc {
+
+/**
+ * `MediaSdk` on top of the Oceana Customer Web Voice Video SDK, for the
+ * shared `CallSession`. Drives the Java `com.avayawebrtc.AvayaMediaSdk`,
+ * which runs the commands on the main looper.
+ */
+class AndroidMediaSdk : public MediaSdk {
+ public:
+  AndroidMediaSdk();
+  ~AndroidMediaSdk() override;
+
+  AndroidMediaSdk(const AndroidMediaSdk&) = delete;
+  AndroidMediaSdk& operator=(const AndroidMediaSdk&) = delete;
+
+  void setListener(MediaSdkListener* listener) override;
+  void configure(const MediaSdkConfiguration& configuration) override;
+  void startCall(CallMedia media, const std::string& destination) override;
+  void endCall() override;
+  void setAudioMuted(bool muted) override;
+  void setVideoEnabled(bool enabled) override;
+  void selectCamera(Camera camera) override;
+  void sendDtmf(DtmfTone tone) override;
+
+  /**
+   * Registers the natives of `com.avayawebrtc.AvayaMediaSdk`. Called from
+   * `JNI_OnLoad`.
+   */
+  static void registerNatives(JNIEnv* env);
+
+ private:
+  static void
+  onProgress(JNIEnv* env, jclass, jlong handle, jint progress, jstring error);
+  static void onQuality(JNIEnv* env, jclass, jlong handle, jstring quality);
+
+  template <typename Callback>
+  void notify(Callback&& callback);
+
+  jobject peer_;
+
+  // Held while calling the listener, so that detaching it waits for the
+  // callback in progress.
+  std::mutex listenerMutex_;
+  MediaSdkListener* listener_{nullptr};
+};
+
+} // namespace avayawebrtc
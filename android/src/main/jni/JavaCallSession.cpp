@@ -0,0 +1,218 @@
+#include "JavaCallSession.h"
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include "AndroidMediaSdk.h"
+#include "CallSession.h"
+#include "JniUtils.h"
+
+namespace avayawebrtc {
+
+namespace {
+
+jclass exceptionClass;
+jmethodID exceptionConstructor;
+jmethodID onNativeEvent;
+
+/**
+ * The native half of a Java `CallSession`, which reports the events of the
+ * shared session to it.
+ */
+class JavaCallSession {
+ public:
+  JavaCallSession(JNIEnv* env, jobject peer)
+      : peer_(env->NewGlobalRef(peer)),
+        session_(
+            std::in_place,
+            std::make_shared<AndroidMediaSdk>(),
+            [this](CallEvent&& event) { report(event); }) {}
+
+  ~JavaCallSession() {
+    // Detach from the SDK before the peer goes away.
+    session_.reset();
+    currentEnv()->DeleteGlobalRef(peer_);
+  }
+
+  CallSession& session() {
+    return *session_;
+  }
+
+ private:
+  void report(const CallEvent& event) {
+    if (event.type != CallEvent::Type::StateChanged) {
+      return;
+    }
+    auto env = currentEnv();
+    auto state = env->NewStringUTF(toString(event.state));
+    auto status = toCallStatus(event.state);
+    auto javaStatus = status ? env->NewStringUTF(status) : nullptr;
+    auto error =
+        event.error.empty() ? nullptr : env->NewStringUTF(event.error.c_str());
+    env->CallVoidMethod(peer_, onNativeEvent, state, javaStatus, error);
+    if (env->ExceptionCheck()) {
+      // Listeners must not fail the command or SDK callback reporting.
+      env->ExceptionDescribe();
+      env->ExceptionClear();
+    }
+    env->DeleteLocalRef(error);
+    env->DeleteLocalRef(javaStatus);
+    env->DeleteLocalRef(state);
+  }
+
+  jobject peer_;
+  std::optional<CallSession> session_;
+};
+
+void throwCallSessionException(
+    JNIEnv* env,
+    const std::string& code,
+    const char* message) {
+  auto javaCode = env->NewStringUTF(code.c_str());
+  auto javaMessage = env->NewStringUTF(message);
+  auto exception = static_cast<jthrowable>(env->NewObject(
+      exceptionClass, exceptionConstructor, javaCode, javaMessage));
+  env->Throw(exception);
+  env->DeleteLocalRef(exception);
+  env->DeleteLocalRef(javaMessage);
+  env->DeleteLocalRef(javaCode);
+}
+
+// Runs a command of the session, throwing a Java `CallSessionException` if
+// it fails.
+template <typename Result, typename Command>
+Result run(JNIEnv* env, Command&& command) {
+  try {
+    return command();
+  } catch (const CallSessionError& error) {
+    throwCallSessionException(env, error.code(), error.what());
+  } catch (const std::exception& error) {
+    throwCallSessionException(env, "sdk_error", error.what());
+  }
+  if constexpr (!std::is_void_v<Result>) {
+    return Result{};
+  }
+}
+
+CallSession& session(jlong handle) {
+  return reinterpret_cast<JavaCallSession*>(handle)->session();
+}
+
+jlong nativeCreate(JNIEnv* env, jobject peer) {
+  return run<jlong>(env, [&]() {
+    return reinterpret_cast<jlong>(new JavaCallSession(env, peer));
+  });
+}
+
+void nativeDestroy(JNIEnv*, jclass, jlong handle) {
+  delete reinterpret_cast<JavaCallSession*>(handle);
+}
+
+void nativeConfigure(
+    JNIEnv* env,
+    jclass,
+    jlong handle,
+    jstring token,
+    jstring gatewayAddress,
+    jstring gatewayPort,
+    jstring gatewayUrlPath) {
+  MediaSdkConfiguration configuration{
+      .token = toStdString(env, token),
+      .gatewayAddress = toStdString(env, gatewayAddress),
+      .gatewayPort = toStdString(env, gatewayPort),
+      .gatewayUrlPath = toStdString(env, gatewayUrlPath)};
+  run<void>(env, [&]() {
+    session(handle).configure(std::move(configuration));
+  });
+}
+
+void nativeStartCall(
+    JNIEnv* env,
+    jclass,
+    jlong handle,
+    jboolean video,
+    jstring destination) {
+  auto media = video ? CallMedia::Video : CallMedia::Audio;
+  auto destinationAddress = toStdString(env, destination);
+  run<void>(
+      env, [&]() { session(handle).startCall(media, destinationAddress); });
+}
+
+jboolean nativeEndCall(JNIEnv* env, jclass, jlong handle) {
+  return run<jboolean>(
+      env, [&]() { return static_cast<jboolean>(session(handle).endCall()); });
+}
+
+void nativeSetAudioMuted(JNIEnv* env, jclass, jlong handle, jboolean muted) {
+  run<void>(env, [&]() { session(handle).setAudioMuted(muted); });
+}
+
+void nativeSetVideoEnabled(
+    JNIEnv* env,
+    jclass,
+    jlong handle,
+    jboolean enabled) {
+  run<void>(env, [&]() { session(handle).setVideoEnabled(enabled); });
+}
+
+jstring nativeSwitchCamera(JNIEnv* env, jclass, jlong handle) {
+  return run<jstring>(env, [&]() {
+    return env->NewStringUTF(toString(session(handle).switchCamera()));
+  });
+}
+
+void nativeSendDtmf(JNIEnv* env, jclass, jlong handle, jstring digit) {
+  auto tone = toStdString(env, digit);
+  run<void>(env, [&]() { session(handle).sendDtmf(tone); });
+}
+
+} // namespace
+
+void registerCallSessionNatives(JNIEnv* env) {
+  exceptionClass = findGlobalClass(env, "com/avayawebrtc/CallSessionException");
+  exceptionConstructor = env->GetMethodID(
+      exceptionClass, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V");
+
+  auto sessionClass = env->FindClass("com/avayawebrtc/CallSession");
+  onNativeEvent = env->GetMethodID(
+      sessionClass,
+      "onNativeEvent",
+      "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V");
+
+  const JNINativeMethod methods[] = {
+      {const_cast<char*>("nativeCreate"),
+       const_cast<char*>("()J"),
+       reinterpret_cast<void*>(&nativeCreate)},
+      {const_cast<char*>("nativeDestroy"),
+       const_cast<char*>("(J)V"),
+       reinterpret_cast<void*>(&nativeDestroy)},
+      {const_cast<char*>("nativeConfigure"),
+       const_cast<char*>("(JLjava/lang/String;Ljava/lang/String;"
+                         "Ljava/lang/String;Ljava/lang/String;)V"),
+       reinterpret_cast<void*>(&nativeConfigure)},
+      {const_cast<char*>("nativeStartCall"),
+       const_cast<char*>("(JZLjava/lang/String;)V"),
+       reinterpret_cast<void*>(&nativeStartCall)},
+      {const_cast<char*>("nativeEndCall"),
+       const_cast<char*>("(J)Z"),
+       reinterpret_cast<void*>(&nativeEndCall)},
+      {const_cast<char*>("nativeSetAudioMuted"),
+       const_cast<char*>("(JZ)V"),
+       reinterpret_cast<void*>(&nativeSetAudioMuted)},
+      {const_cast<char*>("nativeSetVideoEnabled"),
+       const_cast<char*>("(JZ)V"),
+       reinterpret_cast<void*>(&nativeSetVideoEnabled)},
+      {const_cast<char*>("nativeSwitchCamera"),
+       const_cast<char*>("(J)Ljava/lang/String;"),
+       reinterpret_cast<void*>(&nativeSwitchCamera)},
+      {const_cast<char*>("nativeSendDtmf"),
+       const_cast<char*>("(JLjava/lang/String;)V"),
+       reinterpret_cast<void*>(&nativeSendDtmf)},
+  };
+  env->RegisterNatives(
+      sessionClass, methods, sizeof(methods) / sizeof(methods[0]));
+  env->DeleteLocalRef(sessionClass);
+}
+
+} // namespace avayawebrtc
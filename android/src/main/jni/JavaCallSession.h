@@ -0,0 +1,13 @@
+#pragma once
+
+#include <jni.h>
+
+namespace avayawebrtc {
+
+/**
+ * Registers the natives of `com.avayawebrtc.CallSession`, which lets the Java
+ * `CustomModule` drive the shared `CallSession`. Called from `JNI_OnLoad`.
+ */
+void registerCallSessionNatives(JNIEnv* env);
+
+} // namespace avayawebrtc
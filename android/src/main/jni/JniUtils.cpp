@@ -0,0 +1,63 @@
+#include "JniUtils.h"
+
+#include <stdexcept>
+
+namespace avayawebrtc {
+
+namespace {
+
+JavaVM* javaVM = nullptr;
+
+} // namespace
+
+void setJavaVM(JavaVM* vm) {
+  javaVM = vm;
+}
+
+JNIEnv* currentEnv() {
+  JNIEnv* env = nullptr;
+  if (javaVM->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) ==
+      JNI_EDETACHED) {
+    javaVM->AttachCurrentThread(&env, nullptr);
+  }
+  return env;
+}
+
+jclass findGlobalClass(JNIEnv* env, const char* name) {
+  auto localClass = env->FindClass(name);
+  auto globalClass = static_cast<jclass>(env->NewGlobalRef(localClass));
+  env->DeleteLocalRef(localClass);
+  return globalClass;
+}
+
+std::string toStdString(JNIEnv* env, jstring string) {
+  if (string == nullptr) {
+    return {};
+  }
+  auto chars = env->GetStringUTFChars(string, nullptr);
+  std::string result(chars);
+  env->ReleaseStringUTFChars(string, chars);
+  return result;
+}
+
+void rethrowJavaException(JNIEnv* env) {
+  auto throwable = env->ExceptionOccurred();
+  if (throwable == nullptr) {
+    return;
+  }
+  env->ExceptionClear();
+
+  auto throwableClass = env->FindClass("java/lang/Throwable");
+  auto toString =
+      env->GetMethodID(throwableClass, "toString", "()Ljava/lang/String;");
+  auto description =
+      static_cast<jstring>(env->CallObjectMethod(throwable, toString));
+  env->ExceptionClear();
+  auto message = toStdString(env, description);
+  env->DeleteLocalRef(description);
+  env->DeleteLocalRef(throwableClass);
+  env->DeleteLocalRef(throwable);
+  throw std::runtime_error(message);
+}
+
+} // namespace avayawebrtc
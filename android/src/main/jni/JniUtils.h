@@ -0,0 +1,35 @@
+#pragma once
+
+#include <jni.h>
+
+#include <string>
+
+namespace avayawebrtc {
+
+/**
+ * Keeps the `JavaVM`, from `JNI_OnLoad`, so that native code can call into
+ * Java from any thread.
+ */
+void setJavaVM(JavaVM* vm);
+
+/**
+ * The `JNIEnv` of the current thread, which is attached to the VM if it is
+ * not yet.
+ */
+JNIEnv* currentEnv();
+
+/**
+ * Looks up a class and keeps it. Must run on a thread started by Java, whose
+ * class loader knows the app's classes, e.g. in `JNI_OnLoad`.
+ */
+jclass findGlobalClass(JNIEnv* env, const char* name);
+
+std::string toStdString(JNIEnv* env, jstring string);
+
+/**
+ * Turns the Java exception pending on `env`, if any, into a
+ * `std::runtime_error` with its message.
+ */
+void rethrowJavaException(JNIEnv* env);
+
+} // namespace avayawebrtc
@@ -0,0 +1,26 @@
+#include <jni.h>
+
+#include <memory>
+
+#include "AndroidMediaSdk.h"
+#include "JavaCallSession.h"
+#include "JniUtils.h"
+
+using namespace avayawebrtc;
+
+// Runs when `CallSession.java` loads this library, before any module uses
+// the SDK.
+JNIEXPORT jint JNI_OnLoad(JavaVM* vm, void* /*reserved*/) {
+  JNIEnv* env = nullptr;
+  if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK) {
+    return JNI_ERR;
+  }
+  setJavaVM(vm);
+  AndroidMediaSdk::registerNatives(env);
+  registerCallSessionNatives(env);
+  if (env->ExceptionCheck()) {
+    return JNI_ERR;
+  }
+  MediaSdk::setFactory([]() { return std::make_shared<AndroidMediaSdk>(); });
+  return JNI_VERSION_1_6;
+}
@@ -0,0 +1,62 @@
+#include "CallEvent.h"
+
+namespace avayawebrtc {
+
+const char* toString(CallState state) {
+  switch (state) {
+    case CallState::Idle:
+      return "idle";
+    case CallState::Initiating:
+      return "initiating";
+    case CallState::RemoteAlerting:
+      return "remoteAlerting";
+    case CallState::Active:
+      return "active";
+    case CallState::Ending:
+      return "ending";
+    case CallState::Ended:
+      return "ended";
+    case CallState::Failed:
+      return "failed";
+  }
+  return "idle";
+}
+
+const char* toCallStatus(CallState state) {
+  switch (state) {
+    case CallState::Initiating:
+      return "initiating";
+    case CallState::RemoteAlerting:
+      return "ringing";
+    case CallState::Active:
+      return "connected";
+    case CallState::Ended:
+      return "ended";
+    case CallState::Failed:
+      return "error";
+    case CallState::Idle:
+    case CallState::Ending:
+      return nullptr;
+  }
+  return nullptr;
+}
+
+const char* toString(CallQuality quality) {
+  switch (quality) {
+    case CallQuality::Unknown:
+      return "unknown";
+    case CallQuality::Bad:
+      return "bad";
+    case CallQuality::Poor:
+      return "poor";
+    case CallQuality::Fair:
+      return "fair";
+    case CallQuality::Good:
+      return "good";
+    case CallQuality::Excellent:
+      return "excellent";
+  }
+  return "unknown";
+}
+
+} // namespace avayawebrtc
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace avayawebrtc {
+
+/**
+ * The states of a call, in the order a successful call goes through them.
+ */
+enum class CallState : uint8_t {
+  Idle,
+  Initiating,
+  RemoteAlerting,
+  Active,
+  Ending,
+  Ended,
+  Failed,
+};
+
+const char* toString(CallState state);
+
+/**
+ * The `status` of the platform `CustomModule`s' "onCallStateChanged" event
+ * for a state, or `nullptr` if they report none for it.
+ */
+const char* toCallStatus(CallState state);
+
+/**
+ * Whether a call in this state still holds the media SDK.
+ */
+inline bool isInProgress(CallState state) {
+  return state != CallState::Idle && state != CallState::Ended &&
+      state != CallState::Failed;
+}
+
+enum class CallQuality : uint8_t {
+  Unknown,
+  Bad,
+  Poor,
+  Fair,
+  Good,
+  Excellent,
+};
+
+const char* toString(CallQuality quality);
+
+struct CallStats {
+  CallQuality quality{CallQuality::Unknown};
+  uint32_t packetsSent{0};
+  uint32_t packetsReceived{0};
+  uint32_t packetLossPercent{0};
+  uint32_t jitterMilliseconds{0};
+  uint32_t roundTripTimeMilliseconds{0};
+};
+
+/**
+ * What the call session reports to JavaScript. Kept as a plain value so that
+ * it can be queued from any thread and only turned into a JS object on the
+ * JS thread.
+ */
+struct CallEvent {
+  enum class Type : uint8_t {
+    StateChanged,
+    Stats,
+  };
+
+  Type type{Type::StateChanged};
+  // The state of the call once the event happened.
+  CallState state{CallState::Idle};
+  // Set for `Type::Stats` only.
+  CallStats stats{};
+  // Set when the call failed.
+  std::string error{};
+};
+
+} // namespace avayawebrtc
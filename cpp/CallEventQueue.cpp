@@ -0,0 +1,24 @@
+#include "CallEventQueue.h"
+
+namespace avayawebrtc {
+
+bool CallEventQueue::push(CallEvent&& event) {
+  std::lock_guard lock(mutex_);
+  if (event.type == CallEvent::Type::Stats) {
+    if (statsIndex_ != kNoStats) {
+      events_[statsIndex_] = std::move(event);
+      return false;
+    }
+    statsIndex_ = events_.size();
+  }
+  events_.push_back(std::move(event));
+  return events_.size() == 1;
+}
+
+void CallEventQueue::drain(std::vector<CallEvent>& events) {
+  std::lock_guard lock(mutex_);
+  events.swap(events_);
+  statsIndex_ = kNoStats;
+}
+
+} // namespace avayawebrtc
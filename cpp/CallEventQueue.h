@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "CallEvent.h"
+
+namespace avayawebrtc {
+
+/**
+ * Hands call events from the SDK's threads to the JS thread.
+ *
+ * Producers `push` events; whoever pushes into an empty queue schedules a
+ * single `drain` on the JS thread, so a burst of events costs one hop. A
+ * stats event replaces the stats event still waiting in the queue, if any,
+ * since only the latest stats matter once JS gets to them. State changes are
+ * never dropped.
+ */
+class CallEventQueue {
+ public:
+  /**
+   * Queues `event`. Returns true if the queue was empty, in which case the
+   * caller must schedule a `drain`.
+   */
+  bool push(CallEvent&& event);
+
+  /**
+   * Moves the queued events, in order, into `events`, which must be empty.
+   * The queue keeps the capacity of `events` for the next burst.
+   */
+  void drain(std::vector<CallEvent>& events);
+
+ private:
+  std::mutex mutex_;
+  std::vector<CallEvent> events_;
+  // Index of the stats event in `events_`, or `kNoStats`.
+  static constexpr size_t kNoStats = static_cast<size_t>(-1);
+  size_t statsIndex_{kNoStats};
+};
+
+} // namespace avayawebrtc
@@ -0,0 +1,247 @@
+#include "CallSession.h"
+
+namespace avayawebrtc {
+
+CallSession::CallSession(std::shared_ptr<MediaSdk> sdk, EventHandler onEvent)
+    : sdk_(std::move(sdk)), onEvent_(std::move(onEvent)) {
+  sdk_->setListener(this);
+}
+
+CallSession::~CallSession() {
+  sdk_->setListener(nullptr);
+}
+
+void CallSession::configure(MediaSdkConfiguration configuration) {
+  {
+    std::lock_guard lock(mutex_);
+    if (isInProgress(state_)) {
+      throw CallSessionError(
+          "call_in_progress", "Cannot change the configuration during a call");
+    }
+  }
+
+  const bool hasToken = !configuration.token.empty();
+  sdk_->configure(configuration);
+
+  std::lock_guard lock(mutex_);
+  configured_ = true;
+  hasToken_ = hasToken;
+}
+
+void CallSession::startCall(CallMedia media, const std::string& destination) {
+  {
+    std::lock_guard lock(mutex_);
+    if (!configured_) {
+      throw CallSessionError("no_config", "Client configuration not set");
+    }
+    if (!hasToken_) {
+      throw CallSessionError("no_token", "Token not set");
+    }
+    if (isInProgress(state_)) {
+      throw CallSessionError("call_in_progress", "A call is in progress");
+    }
+    media_ = media;
+    camera_ = Camera::Front;
+    transition(CallState::Initiating);
+  }
+  deliverEvents();
+
+  // The SDK may report progress before returning, so it is called without
+  // holding the lock.
+  try {
+    sdk_->startCall(media, destination);
+  } catch (const std::exception& error) {
+    {
+      std::lock_guard lock(mutex_);
+      advance(CallState::Failed, error.what());
+    }
+    deliverEvents();
+    throw;
+  }
+}
+
+bool CallSession::endCall() {
+  {
+    std::lock_guard lock(mutex_);
+    if (!isInProgress(state_)) {
+      return false;
+    }
+    if (state_ == CallState::Ending) {
+      return true;
+    }
+    transition(CallState::Ending);
+  }
+  deliverEvents();
+
+  sdk_->endCall();
+  return true;
+}
+
+void CallSession::setAudioMuted(bool muted) {
+  requireCall();
+  sdk_->setAudioMuted(muted);
+}
+
+void CallSession::setVideoEnabled(bool enabled) {
+  if (requireCall() != CallMedia::Video) {
+    throw CallSessionError("no_video_call", "The call has no video");
+  }
+  sdk_->setVideoEnabled(enabled);
+}
+
+Camera CallSession::switchCamera() {
+  if (requireCall() != CallMedia::Video) {
+    throw CallSessionError("no_video_call", "The call has no video");
+  }
+  Camera camera;
+  {
+    std::lock_guard lock(mutex_);
+    camera_ = camera = camera_ == Camera::Front ? Camera::Back : Camera::Front;
+  }
+  sdk_->selectCamera(camera);
+  return camera;
+}
+
+void CallSession::sendDtmf(std::string_view digit) {
+  auto tone = parseDtmfTone(digit);
+  if (!tone) {
+    throw CallSessionError(
+        "invalid_dtmf", "Invalid DTMF digit: " + std::string(digit));
+  }
+  requireCall();
+  sdk_->sendDtmf(*tone);
+}
+
+CallState CallSession::state() const {
+  std::lock_guard lock(mutex_);
+  return state_;
+}
+
+std::optional<DtmfTone> CallSession::parseDtmfTone(std::string_view digit) {
+  if (digit.size() != 1) {
+    return std::nullopt;
+  }
+  auto character = digit[0];
+  if (character >= '0' && character <= '9') {
+    return static_cast<DtmfTone>(character - '0');
+  }
+  switch (character) {
+    case '*':
+      return DtmfTone::Star;
+    case '#':
+      return DtmfTone::Pound;
+    case 'A':
+    case 'a':
+      return DtmfTone::A;
+    case 'B':
+    case 'b':
+      return DtmfTone::B;
+    case 'C':
+    case 'c':
+      return DtmfTone::C;
+    case 'D':
+    case 'd':
+      return DtmfTone::D;
+    default:
+      return std::nullopt;
+  }
+}
+
+void CallSession::onInitiating() {
+  {
+    std::lock_guard lock(mutex_);
+    advance(CallState::Initiating);
+  }
+  deliverEvents();
+}
+
+void CallSession::onRemoteAlerting() {
+  {
+    std::lock_guard lock(mutex_);
+    advance(CallState::RemoteAlerting);
+  }
+  deliverEvents();
+}
+
+void CallSession::onActive() {
+  {
+    std::lock_guard lock(mutex_);
+    advance(CallState::Active);
+  }
+  deliverEvents();
+}
+
+void CallSession::onEnded() {
+  {
+    std::lock_guard lock(mutex_);
+    advance(CallState::Ended);
+  }
+  deliverEvents();
+}
+
+void CallSession::onFailed(const std::string& error) {
+  {
+    std::lock_guard lock(mutex_);
+    advance(CallState::Failed, error);
+  }
+  deliverEvents();
+}
+
+void CallSession::onStats(const CallStats& stats) {
+  {
+    std::lock_guard lock(mutex_);
+    if (state_ != CallState::Active) {
+      return;
+    }
+    pendingEvents_.push_back(CallEvent{
+        .type = CallEvent::Type::Stats, .state = state_, .stats = stats});
+  }
+  deliverEvents();
+}
+
+CallMedia CallSession::requireCall() const {
+  std::lock_guard lock(mutex_);
+  if (!isInProgress(state_)) {
+    throw CallSessionError("no_call", "No call in progress");
+  }
+  return media_;
+}
+
+void CallSession::advance(CallState state, std::string error) {
+  if (isInProgress(state_) && state > state_) {
+    transition(state, std::move(error));
+  }
+}
+
+void CallSession::transition(CallState state, std::string error) {
+  state_ = state;
+  pendingEvents_.push_back(CallEvent{
+      .type = CallEvent::Type::StateChanged,
+      .state = state,
+      .error = std::move(error)});
+}
+
+void CallSession::deliverEvents() {
+  std::unique_lock lock(mutex_);
+  if (deliveringEvents_) {
+    return;
+  }
+  deliveringEvents_ = true;
+  while (!pendingEvents_.empty()) {
+    auto event = std::move(pendingEvents_.front());
+    pendingEvents_.pop_front();
+    lock.unlock();
+    try {
+      onEvent_(std::move(event));
+    } catch (...) {
+      // The remaining events go out with the next ones.
+      lock.lock();
+      deliveringEvents_ = false;
+      throw;
+    }
+    lock.lock();
+  }
+  deliveringEvents_ = false;
+}
+
+} // namespace avayawebrtc
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "CallEvent.h"
+#include "MediaSdk.h"
+
+namespace avayawebrtc {
+
+/**
+ * A command the call session refused. `code()` matches the promise rejection
+ * codes of the platform modules ("no_config", "no_call", ...).
+ */
+class CallSessionError : public std::runtime_error {
+ public:
+  CallSessionError(std::string code, const std::string& message)
+      : std::runtime_error(message), code_(std::move(code)) {}
+
+  const std::string& code() const {
+    return code_;
+  }
+
+ private:
+  std::string code_;
+};
+
+/**
+ * The state machine of a single audio or video call, shared by iOS and
+ * Android. Commands come from the JS thread and progress from the SDK's
+ * threads; every state change and stats update is reported to `onEvent` in
+ * order, from the thread that caused it or from one that is already
+ * reporting earlier events. `onEvent` is called without holding any lock, so
+ * it may call back into the session.
+ */
+class CallSession : private MediaSdkListener {
+ public:
+  using EventHandler = std::function<void(CallEvent&& event)>;
+
+  CallSession(std::shared_ptr<MediaSdk> sdk, EventHandler onEvent);
+  ~CallSession() override;
+
+  CallSession(const CallSession&) = delete;
+  CallSession& operator=(const CallSession&) = delete;
+
+  void configure(MediaSdkConfiguration configuration);
+  void startCall(CallMedia media, const std::string& destination);
+
+  /**
+   * Asks the SDK to end the current call. Returns false if there is none.
+   */
+  bool endCall();
+
+  void setAudioMuted(bool muted);
+  void setVideoEnabled(bool enabled);
+
+  /**
+   * Switches between the front and back camera of a video call, which starts
+   * with the front one. Returns the camera now in use.
+   */
+  Camera switchCamera();
+
+  void sendDtmf(std::string_view digit);
+
+  CallState state() const;
+
+  static std::optional<DtmfTone> parseDtmfTone(std::string_view digit);
+
+ private:
+  void onInitiating() override;
+  void onRemoteAlerting() override;
+  void onActive() override;
+  void onEnded() override;
+  void onFailed(const std::string& error) override;
+  void onStats(const CallStats& stats) override;
+
+  // Throws unless a call is in progress, and returns its media.
+  CallMedia requireCall() const;
+
+  // Moves to `state` if the current state is in progress and comes before
+  // it. Callbacks for calls that already ended are dropped this way.
+  void advance(CallState state, std::string error = {});
+  // Must be called with `mutex_` held. The event is queued until the caller
+  // releases the lock and calls `deliverEvents`.
+  void transition(CallState state, std::string error = {});
+  // Must be called without holding `mutex_`.
+  void deliverEvents();
+
+  const std::shared_ptr<MediaSdk> sdk_;
+  const EventHandler onEvent_;
+
+  mutable std::mutex mutex_;
+  CallState state_{CallState::Idle};
+  CallMedia media_{CallMedia::Audio};
+  Camera camera_{Camera::Front};
+  bool configured_{false};
+  bool hasToken_{false};
+  std::deque<CallEvent> pendingEvents_;
+  // Whether a thread is delivering `pendingEvents_`. Others leave theirs to
+  // it, which keeps events in order and lets `onEvent_` re-enter.
+  bool deliveringEvents_{false};
+};
+
+} // namespace avayawebrtc
@@ -0,0 +1,39 @@
+#include "MediaSdk.h"
+
+#include <mutex>
+
+namespace avayawebrtc {
+
+namespace {
+
+std::mutex& factoryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+MediaSdk::Factory& factory() {
+  static MediaSdk::Factory factory;
+  return factory;
+}
+
+} // namespace
+
+const char* toString(Camera camera) {
+  return camera == Camera::Back ? "back" : "front";
+}
+
+void MediaSdk::setFactory(Factory newFactory) {
+  std::lock_guard lock(factoryMutex());
+  factory() = std::move(newFactory);
+}
+
+std::shared_ptr<MediaSdk> MediaSdk::create() {
+  Factory currentFactory;
+  {
+    std::lock_guard lock(factoryMutex());
+    currentFactory = factory();
+  }
+  return currentFactory ? currentFactory() : nullptr;
+}
+
+} // namespace avayawebrtc
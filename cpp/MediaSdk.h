@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "CallEvent.h"
+
+namespace avayawebrtc {
+
+struct MediaSdkConfiguration {
+  std::string token{};
+  std::string gatewayAddress{};
+  std::string gatewayPort{};
+  std::string gatewayUrlPath{};
+};
+
+enum class CallMedia : uint8_t {
+  Audio,
+  Video,
+};
+
+enum class Camera : uint8_t {
+  Front,
+  Back,
+};
+
+const char* toString(Camera camera);
+
+enum class DtmfTone : uint8_t {
+  Zero,
+  One,
+  Two,
+  Three,
+  Four,
+  Five,
+  Six,
+  Seven,
+  Eight,
+  Nine,
+  Star,
+  Pound,
+  A,
+  B,
+  C,
+  D,
+};
+
+/**
+ * Receives the call progress of a `MediaSdk`. The callbacks may come from
+ * any thread, but never concurrently with each other.
+ */
+class MediaSdkListener {
+ public:
+  virtual ~MediaSdkListener() = default;
+
+  virtual void onInitiating() = 0;
+  virtual void onRemoteAlerting() = 0;
+  virtual void onActive() = 0;
+  virtual void onEnded() = 0;
+  virtual void onFailed(const std::string& error) = 0;
+  virtual void onStats(const CallStats& stats) = 0;
+};
+
+/**
+ * The calls the call session needs from the platform's Avaya SDK. Each
+ * platform wraps its SDK in an implementation of this interface; tests use
+ * a fake one.
+ *
+ * Commands may run asynchronously, e.g. on the thread the SDK must be used
+ * from: failures found up front are thrown as `std::exception`s, which are
+ * reported to JavaScript, and later ones are reported through `onFailed`.
+ */
+class MediaSdk {
+ public:
+  using Factory = std::function<std::shared_ptr<MediaSdk>()>;
+
+  virtual ~MediaSdk() = default;
+
+  /**
+   * Sets the listener for the current and future calls. Once it returns, the
+   * previous listener is not called anymore, so `nullptr` detaches it.
+   */
+  virtual void setListener(MediaSdkListener* listener) = 0;
+
+  virtual void configure(const MediaSdkConfiguration& configuration) = 0;
+  virtual void startCall(CallMedia media, const std::string& destination) = 0;
+  virtual void endCall() = 0;
+  virtual void setAudioMuted(bool muted) = 0;
+  virtual void setVideoEnabled(bool enabled) = 0;
+  virtual void selectCamera(Camera camera) = 0;
+  virtual void sendDtmf(DtmfTone tone) = 0;
+
+  /**
+   * Registers how modules created by autolinking, which only get a
+   * `CallInvoker`, get their SDK.
+   */
+  static void setFactory(Factory factory);
+
+  /**
+   * Returns a new SDK from the registered factory, or `nullptr` if the
+   * platform did not register one.
+   */
+  static std::shared_ptr<MediaSdk> create();
+};
+
+} // namespace avayawebrtc
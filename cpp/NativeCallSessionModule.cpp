@@ -0,0 +1,268 @@
+#include "NativeCallSessionModule.h"
+
+#include <string>
+
+using namespace avayawebrtc;
+
+namespace facebook::react {
+
+namespace {
+
+[[noreturn]] void
+throwError(jsi::Runtime& rt, const std::string& code, const char* message) {
+  auto error = rt.global()
+                   .getPropertyAsFunction(rt, "Error")
+                   .callAsConstructor(rt, message)
+                   .asObject(rt);
+  error.setProperty(rt, "code", code);
+  throw jsi::JSError(rt, jsi::Value(rt, error));
+}
+
+// Runs a command of the session, reporting its failure as a JS error.
+template <typename Command>
+auto run(jsi::Runtime& rt, Command&& command) {
+  try {
+    return command();
+  } catch (const CallSessionError& error) {
+    throwError(rt, error.code(), error.what());
+  } catch (const jsi::JSIException&) {
+    throw;
+  } catch (const std::exception& error) {
+    throwError(rt, "sdk_error", error.what());
+  }
+}
+
+NativeCallSessionModule& asModule(TurboModule& turboModule) {
+  return static_cast<NativeCallSessionModule&>(turboModule);
+}
+
+std::string stringProperty(
+    jsi::Runtime& rt,
+    const jsi::Object& object,
+    const char* name) {
+  auto value = object.getProperty(rt, name);
+  if (value.isString()) {
+    return value.getString(rt).utf8(rt);
+  }
+  if (value.isNumber()) {
+    return std::to_string(static_cast<int64_t>(value.getNumber()));
+  }
+  return {};
+}
+
+} // namespace
+
+NativeCallSessionModule::NativeCallSessionModule(
+    std::shared_ptr<CallInvoker> jsInvoker)
+    : NativeCallSessionModule(std::move(jsInvoker), nullptr) {}
+
+NativeCallSessionModule::NativeCallSessionModule(
+    std::shared_ptr<CallInvoker> jsInvoker,
+    std::shared_ptr<MediaSdk> sdk)
+    : TurboModule(std::string{kModuleName}, jsInvoker),
+      delivery_(std::make_shared<Delivery>()),
+      sdk_(std::move(sdk)) {
+  methodMap_["configure"] = MethodMetadata{1, configure};
+  methodMap_["startAudioCall"] = MethodMetadata{1, startAudioCall};
+  methodMap_["startVideoCall"] = MethodMetadata{1, startVideoCall};
+  methodMap_["endCall"] = MethodMetadata{0, endCall};
+  methodMap_["setAudioMuted"] = MethodMetadata{1, setAudioMuted};
+  methodMap_["setVideoEnabled"] = MethodMetadata{1, setVideoEnabled};
+  methodMap_["switchCamera"] = MethodMetadata{0, switchCamera};
+  methodMap_["sendDtmf"] = MethodMetadata{1, sendDtmf};
+  methodMap_["getState"] = MethodMetadata{0, getState};
+  methodMap_["setListener"] = MethodMetadata{1, setListener};
+}
+
+NativeCallSessionModule::~NativeCallSessionModule() {
+  // Detach from the SDK before the queue goes away.
+  session_.reset();
+}
+
+CallSession& NativeCallSessionModule::session(jsi::Runtime& rt) {
+  if (session_) {
+    return *session_;
+  }
+  auto sdk = sdk_ ? std::move(sdk_) : MediaSdk::create();
+  if (!sdk) {
+    throwError(rt, "no_media_sdk", "No media SDK is registered");
+  }
+  session_ = std::make_unique<CallSession>(
+      std::move(sdk),
+      [weakDelivery = std::weak_ptr<Delivery>(delivery_),
+       jsInvoker = jsInvoker_](CallEvent&& event) {
+        auto delivery = weakDelivery.lock();
+        if (!delivery || !delivery->queue.push(std::move(event))) {
+          return;
+        }
+        jsInvoker->invokeAsync([weakDelivery](jsi::Runtime& rt) {
+          if (auto delivery = weakDelivery.lock()) {
+            deliver(rt, *delivery);
+          }
+        });
+      });
+  return *session_;
+}
+
+void NativeCallSessionModule::deliver(jsi::Runtime& rt, Delivery& delivery) {
+  auto& events = delivery.events;
+  delivery.queue.drain(events);
+  try {
+    for (const auto& event : events) {
+      if (delivery.listener) {
+        (*delivery.listener)(toJs(rt, event));
+      }
+    }
+  } catch (...) {
+    events.clear();
+    throw;
+  }
+  events.clear();
+}
+
+jsi::Object NativeCallSessionModule::toJs(
+    jsi::Runtime& rt,
+    const CallEvent& event) {
+  jsi::Object object(rt);
+  object.setProperty(rt, "state", toString(event.state));
+  if (event.type == CallEvent::Type::Stats) {
+    const auto& stats = event.stats;
+    object.setProperty(rt, "type", "stats");
+    object.setProperty(rt, "quality", toString(stats.quality));
+    object.setProperty(
+        rt, "packetsSent", static_cast<double>(stats.packetsSent));
+    object.setProperty(
+        rt, "packetsReceived", static_cast<double>(stats.packetsReceived));
+    object.setProperty(
+        rt, "packetLossPercent", static_cast<double>(stats.packetLossPercent));
+    object.setProperty(
+        rt, "jitterMs", static_cast<double>(stats.jitterMilliseconds));
+    object.setProperty(
+        rt,
+        "roundTripTimeMs",
+        static_cast<double>(stats.roundTripTimeMilliseconds));
+  } else {
+    object.setProperty(rt, "type", "state");
+    if (!event.error.empty()) {
+      object.setProperty(rt, "error", event.error);
+    }
+  }
+  return object;
+}
+
+jsi::Value NativeCallSessionModule::configure(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  auto config = args[0].asObject(rt);
+  MediaSdkConfiguration configuration{
+      .token = stringProperty(rt, config, "token"),
+      .gatewayAddress = stringProperty(rt, config, "aawg_server"),
+      .gatewayPort = stringProperty(rt, config, "aawg_port"),
+      .gatewayUrlPath = stringProperty(rt, config, "aawg_url_path")};
+  auto& session = asModule(turboModule).session(rt);
+  run(rt, [&]() { session.configure(std::move(configuration)); });
+  return jsi::Value::undefined();
+}
+
+jsi::Value NativeCallSessionModule::startAudioCall(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  auto destination = args[0].asString(rt).utf8(rt);
+  auto& session = asModule(turboModule).session(rt);
+  run(rt, [&]() { session.startCall(CallMedia::Audio, destination); });
+  return jsi::Value::undefined();
+}
+
+jsi::Value NativeCallSessionModule::startVideoCall(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  auto destination = args[0].asString(rt).utf8(rt);
+  auto& session = asModule(turboModule).session(rt);
+  run(rt, [&]() { session.startCall(CallMedia::Video, destination); });
+  return jsi::Value::undefined();
+}
+
+jsi::Value NativeCallSessionModule::endCall(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* /*args*/,
+    size_t /*count*/) {
+  auto& session = asModule(turboModule).session(rt);
+  return run(rt, [&]() { return jsi::Value(session.endCall()); });
+}
+
+jsi::Value NativeCallSessionModule::setAudioMuted(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  auto muted = args[0].asBool();
+  auto& session = asModule(turboModule).session(rt);
+  run(rt, [&]() { session.setAudioMuted(muted); });
+  return jsi::Value::undefined();
+}
+
+jsi::Value NativeCallSessionModule::setVideoEnabled(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  auto enabled = args[0].asBool();
+  auto& session = asModule(turboModule).session(rt);
+  run(rt, [&]() { session.setVideoEnabled(enabled); });
+  return jsi::Value::undefined();
+}
+
+jsi::Value NativeCallSessionModule::switchCamera(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* /*args*/,
+    size_t /*count*/) {
+  auto& session = asModule(turboModule).session(rt);
+  auto camera = run(rt, [&]() { return session.switchCamera(); });
+  return jsi::String::createFromAscii(rt, toString(camera));
+}
+
+jsi::Value NativeCallSessionModule::sendDtmf(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  auto digit = args[0].asString(rt).utf8(rt);
+  auto& session = asModule(turboModule).session(rt);
+  run(rt, [&]() { session.sendDtmf(digit); });
+  return jsi::Value::undefined();
+}
+
+jsi::Value NativeCallSessionModule::getState(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* /*args*/,
+    size_t /*count*/) {
+  auto& session = asModule(turboModule).session(rt);
+  return jsi::String::createFromAscii(rt, toString(session.state()));
+}
+
+jsi::Value NativeCallSessionModule::setListener(
+    jsi::Runtime& rt,
+    TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t count) {
+  auto& self = asModule(turboModule);
+  auto& listener = self.delivery_->listener;
+  if (count == 0 || args[0].isNull() || args[0].isUndefined()) {
+    listener.reset();
+  } else {
+    listener.emplace(
+        rt, args[0].asObject(rt).asFunction(rt), self.jsInvoker_);
+  }
+  return jsi::Value::undefined();
+}
+
+} // namespace facebook::react
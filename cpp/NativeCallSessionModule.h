@@ -0,0 +1,128 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <ReactCommon/TurboModule.h>
+#include <react/bridging/Function.h>
+
+#include "CallEventQueue.h"
+#include "CallSession.h"
+
+namespace facebook::react {
+
+/**
+ * The `CallSession` TurboModule. Unlike the platform `CustomModule`s, it
+ * reports call events straight to the JS thread through its `CallInvoker`,
+ * without a hop through the main queue.
+ *
+ * JS API:
+ *   configure({token, aawg_server, aawg_port, aawg_url_path})
+ *   startAudioCall(destination) / startVideoCall(destination)
+ *   endCall(): boolean
+ *   setAudioMuted(muted) / setVideoEnabled(enabled) / sendDtmf(digit)
+ *   switchCamera(): "front" | "back"
+ *   getState(): string
+ *   setListener(listener: ?(event) => void)
+ *
+ * Refused commands throw an `Error` with a `code` property.
+ *
+ * Lives in `facebook::react`, where Android autolinking looks up C++ modules.
+ */
+class NativeCallSessionModule : public TurboModule {
+ public:
+  static constexpr std::string_view kModuleName = "CallSession";
+
+  /**
+   * Uses the SDK of `MediaSdk::create()`, created by the first command so
+   * that the platform may register its factory after the module is created.
+   * Commands throw "no_media_sdk" if it registered none.
+   */
+  explicit NativeCallSessionModule(std::shared_ptr<CallInvoker> jsInvoker);
+
+  NativeCallSessionModule(
+      std::shared_ptr<CallInvoker> jsInvoker,
+      std::shared_ptr<avayawebrtc::MediaSdk> sdk);
+
+  ~NativeCallSessionModule() override;
+
+ private:
+  using Listener = SyncCallback<void(jsi::Object)>;
+
+  // Shared with the scheduled drains, which may outlive the module.
+  struct Delivery {
+    avayawebrtc::CallEventQueue queue;
+    // Only used on the JS thread.
+    std::optional<Listener> listener;
+    std::vector<avayawebrtc::CallEvent> events;
+  };
+
+  avayawebrtc::CallSession& session(jsi::Runtime& rt);
+
+  static void deliver(jsi::Runtime& rt, Delivery& delivery);
+
+  static jsi::Object toJs(
+      jsi::Runtime& rt,
+      const avayawebrtc::CallEvent& event);
+
+  static jsi::Value configure(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value startAudioCall(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value startVideoCall(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value endCall(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value setAudioMuted(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value setVideoEnabled(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value switchCamera(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value sendDtmf(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value getState(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+  static jsi::Value setListener(
+      jsi::Runtime& rt,
+      TurboModule& turboModule,
+      const jsi::Value* args,
+      size_t count);
+
+  const std::shared_ptr<Delivery> delivery_;
+  // The SDK given to the constructor, until the session takes it over.
+  std::shared_ptr<avayawebrtc::MediaSdk> sdk_;
+  // Only used on the JS thread. Null until the first command.
+  std::unique_ptr<avayawebrtc::CallSession> session_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,87 @@
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../CallEventQueue.h"
+
+namespace avayawebrtc {
+
+namespace {
+
+CallEvent stateChanged(CallState state) {
+  return CallEvent{.type = CallEvent::Type::StateChanged, .state = state};
+}
+
+CallEvent stats(uint32_t packetsReceived) {
+  return CallEvent{
+      .type = CallEvent::Type::Stats,
+      .state = CallState::Active,
+      .stats = {.packetsReceived = packetsReceived}};
+}
+
+} // namespace
+
+TEST(CallEventQueueTest, asksForADrainOncePerBurst) {
+  CallEventQueue queue;
+  EXPECT_TRUE(queue.push(stateChanged(CallState::Initiating)));
+  EXPECT_FALSE(queue.push(stateChanged(CallState::RemoteAlerting)));
+
+  std::vector<CallEvent> events;
+  queue.drain(events);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].state, CallState::Initiating);
+  EXPECT_EQ(events[1].state, CallState::RemoteAlerting);
+
+  events.clear();
+  EXPECT_TRUE(queue.push(stateChanged(CallState::Active)));
+}
+
+TEST(CallEventQueueTest, keepsOnlyTheLatestStats) {
+  CallEventQueue queue;
+  EXPECT_TRUE(queue.push(stats(1)));
+  EXPECT_FALSE(queue.push(stateChanged(CallState::Active)));
+  EXPECT_FALSE(queue.push(stats(2)));
+  EXPECT_FALSE(queue.push(stats(3)));
+
+  std::vector<CallEvent> events;
+  queue.drain(events);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].type, CallEvent::Type::Stats);
+  EXPECT_EQ(events[0].stats.packetsReceived, 3u);
+  EXPECT_EQ(events[1].state, CallState::Active);
+
+  // Stats pushed after a drain are delivered again.
+  events.clear();
+  EXPECT_TRUE(queue.push(stats(4)));
+  queue.drain(events);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].stats.packetsReceived, 4u);
+}
+
+TEST(CallEventQueueTest, deliversEveryStateChangeAcrossThreads) {
+  constexpr int kEventsPerThread = 10000;
+  CallEventQueue queue;
+  std::vector<std::thread> producers;
+  for (int i = 0; i < 4; i++) {
+    producers.emplace_back([&queue]() {
+      for (int j = 0; j < kEventsPerThread; j++) {
+        queue.push(stateChanged(CallState::Active));
+      }
+    });
+  }
+
+  size_t delivered = 0;
+  std::vector<CallEvent> events;
+  while (delivered < 4 * kEventsPerThread) {
+    queue.drain(events);
+    delivered += events.size();
+    events.clear();
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(delivered, 4u * kEventsPerThread);
+}
+
+} // namespace avayawebrtc
@@ -0,0 +1,331 @@
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../CallSession.h"
+
+namespace avayawebrtc {
+
+namespace {
+
+/*
+ * Records the commands of the session and lets tests report call progress,
+ * like the Avaya SDK's delegate callbacks would.
+ */
+class FakeMediaSdk : public MediaSdk {
+ public:
+  void setListener(MediaSdkListener* listener) override {
+    listener_ = listener;
+  }
+
+  void configure(const MediaSdkConfiguration& configuration) override {
+    commands.push_back("configure " + configuration.gatewayAddress);
+  }
+
+  void startCall(CallMedia media, const std::string& destination) override {
+    if (failToStart) {
+      throw std::runtime_error("no network");
+    }
+    commands.push_back(
+        (media == CallMedia::Audio ? "startAudio " : "startVideo ") +
+        destination);
+    if (reportInitiatingOnStart) {
+      listener_->onInitiating();
+    }
+  }
+
+  void endCall() override {
+    commands.push_back("end");
+  }
+
+  void setAudioMuted(bool muted) override {
+    commands.push_back(muted ? "mute" : "unmute");
+  }
+
+  void setVideoEnabled(bool enabled) override {
+    commands.push_back(enabled ? "enableVideo" : "disableVideo");
+  }
+
+  void selectCamera(Camera camera) override {
+    commands.push_back(std::string("camera ") + toString(camera));
+  }
+
+  void sendDtmf(DtmfTone tone) override {
+    commands.push_back("dtmf " + std::to_string(static_cast<int>(tone)));
+  }
+
+  MediaSdkListener& listener() {
+    return *listener_;
+  }
+
+  bool hasListener() const {
+    return listener_ != nullptr;
+  }
+
+  std::vector<std::string> commands;
+  bool failToStart{false};
+  bool reportInitiatingOnStart{false};
+
+ private:
+  MediaSdkListener* listener_{nullptr};
+};
+
+class CallSessionTest : public ::testing::Test {
+ protected:
+  CallSessionTest()
+      : sdk_(std::make_shared<FakeMediaSdk>()),
+        session_(std::make_unique<CallSession>(sdk_, [this](CallEvent&& event) {
+          events_.push_back(std::move(event));
+          if (onEvent_) {
+            onEvent_(events_.back());
+          }
+        })) {}
+
+  void configure(std::string token = "token") {
+    session_->configure(
+        {.token = std::move(token), .gatewayAddress = "gateway.example"});
+  }
+
+  std::vector<CallState> states() const {
+    std::vector<CallState> states;
+    for (const auto& event : events_) {
+      if (event.type == CallEvent::Type::StateChanged) {
+        states.push_back(event.state);
+      }
+    }
+    return states;
+  }
+
+  std::shared_ptr<FakeMediaSdk> sdk_;
+  std::vector<CallEvent> events_;
+  // Called after an event is recorded, like a JS listener would be.
+  std::function<void(const CallEvent&)> onEvent_;
+  std::unique_ptr<CallSession> session_;
+};
+
+} // namespace
+
+TEST_F(CallSessionTest, refusesCallsWithoutConfigurationOrToken) {
+  try {
+    session_->startCall(CallMedia::Audio, "1234");
+    FAIL() << "startCall should throw";
+  } catch (const CallSessionError& error) {
+    EXPECT_EQ(error.code(), "no_config");
+  }
+
+  configure("");
+  try {
+    session_->startCall(CallMedia::Audio, "1234");
+    FAIL() << "startCall should throw";
+  } catch (const CallSessionError& error) {
+    EXPECT_EQ(error.code(), "no_token");
+  }
+
+  EXPECT_EQ(session_->state(), CallState::Idle);
+  EXPECT_TRUE(events_.empty());
+}
+
+TEST_F(CallSessionTest, reportsTheProgressOfACall) {
+  configure();
+  session_->startCall(CallMedia::Audio, "1234");
+  sdk_->listener().onInitiating();
+  sdk_->listener().onRemoteAlerting();
+  sdk_->listener().onActive();
+  EXPECT_TRUE(session_->endCall());
+  sdk_->listener().onEnded();
+
+  EXPECT_EQ(
+      sdk_->commands,
+      (std::vector<std::string>{
+          "configure gateway.example", "startAudio 1234", "end"}));
+  EXPECT_EQ(
+      states(),
+      (std::vector<CallState>{
+          CallState::Initiating,
+          CallState::RemoteAlerting,
+          CallState::Active,
+          CallState::Ending,
+          CallState::Ended}));
+  EXPECT_FALSE(session_->endCall());
+}
+
+TEST_F(CallSessionTest, acceptsProgressReportedWhileStarting) {
+  sdk_->reportInitiatingOnStart = true;
+  configure();
+  session_->startCall(CallMedia::Audio, "1234");
+
+  EXPECT_EQ(states(), (std::vector<CallState>{CallState::Initiating}));
+}
+
+TEST_F(CallSessionTest, dropsStaleProgress) {
+  configure();
+  session_->startCall(CallMedia::Audio, "1234");
+  sdk_->listener().onActive();
+  // The SDK may report steps it skipped once the call is further along.
+  sdk_->listener().onRemoteAlerting();
+  sdk_->listener().onEnded();
+  sdk_->listener().onFailed("late");
+  sdk_->listener().onActive();
+
+  EXPECT_EQ(
+      states(),
+      (std::vector<CallState>{
+          CallState::Initiating, CallState::Active, CallState::Ended}));
+}
+
+TEST_F(CallSessionTest, reportsFailures) {
+  configure();
+  session_->startCall(CallMedia::Video, "1234");
+  sdk_->listener().onFailed("busy");
+
+  ASSERT_EQ(events_.size(), 2u);
+  EXPECT_EQ(events_[1].state, CallState::Failed);
+  EXPECT_EQ(events_[1].error, "busy");
+
+  // A new call can start after a failed one.
+  session_->startCall(CallMedia::Audio, "5678");
+  EXPECT_EQ(session_->state(), CallState::Initiating);
+}
+
+TEST_F(CallSessionTest, failsTheCallWhenTheSdkCannotStartIt) {
+  sdk_->failToStart = true;
+  configure();
+  EXPECT_THROW(
+      session_->startCall(CallMedia::Audio, "1234"), std::runtime_error);
+
+  EXPECT_EQ(
+      states(),
+      (std::vector<CallState>{CallState::Initiating, CallState::Failed}));
+  EXPECT_EQ(events_.back().error, "no network");
+}
+
+TEST_F(CallSessionTest, letsListenersCallBackIntoTheSession) {
+  onEvent_ = [this](const CallEvent& event) {
+    EXPECT_EQ(session_->state(), events_.back().state);
+    if (event.state == CallState::Active) {
+      EXPECT_TRUE(session_->endCall());
+    } else if (event.state == CallState::Ended) {
+      session_->startCall(CallMedia::Audio, "5678");
+    }
+  };
+  configure();
+  session_->startCall(CallMedia::Audio, "1234");
+  sdk_->listener().onActive();
+  sdk_->listener().onEnded();
+
+  // Events caused by the listener come after the one it handles.
+  EXPECT_EQ(
+      states(),
+      (std::vector<CallState>{
+          CallState::Initiating,
+          CallState::Active,
+          CallState::Ending,
+          CallState::Ended,
+          CallState::Initiating}));
+  EXPECT_EQ(
+      sdk_->commands,
+      (std::vector<std::string>{
+          "configure gateway.example",
+          "startAudio 1234",
+          "end",
+          "startAudio 5678"}));
+}
+
+TEST_F(CallSessionTest, refusesASecondCallOrReconfiguration) {
+  configure();
+  session_->startCall(CallMedia::Audio, "1234");
+
+  EXPECT_THROW(session_->startCall(CallMedia::Audio, "5678"), CallSessionError);
+  EXPECT_THROW(configure(), CallSessionError);
+}
+
+TEST_F(CallSessionTest, forwardsCallControlsOnlyDuringACall) {
+  configure();
+  EXPECT_THROW(session_->setAudioMuted(true), CallSessionError);
+  EXPECT_THROW(session_->sendDtmf("1"), CallSessionError);
+
+  session_->startCall(CallMedia::Audio, "1234");
+  session_->setAudioMuted(true);
+  session_->sendDtmf("#");
+  EXPECT_THROW(session_->setVideoEnabled(false), CallSessionError);
+  EXPECT_THROW(session_->sendDtmf("12"), CallSessionError);
+
+  EXPECT_EQ(
+      sdk_->commands,
+      (std::vector<std::string>{
+          "configure gateway.example", "startAudio 1234", "mute", "dtmf 11"}));
+}
+
+TEST_F(CallSessionTest, switchesCamerasOfVideoCallsOnly) {
+  configure();
+  session_->startCall(CallMedia::Audio, "1234");
+  EXPECT_THROW(session_->switchCamera(), CallSessionError);
+  sdk_->listener().onEnded();
+
+  session_->startCall(CallMedia::Video, "1234");
+  EXPECT_EQ(session_->switchCamera(), Camera::Back);
+  EXPECT_EQ(session_->switchCamera(), Camera::Front);
+  EXPECT_EQ(session_->switchCamera(), Camera::Back);
+  sdk_->listener().onEnded();
+
+  // Every video call starts with the front camera.
+  session_->startCall(CallMedia::Video, "1234");
+  EXPECT_EQ(session_->switchCamera(), Camera::Back);
+
+  EXPECT_EQ(
+      sdk_->commands,
+      (std::vector<std::string>{
+          "configure gateway.example",
+          "startAudio 1234",
+          "startVideo 1234",
+          "camera back",
+          "camera front",
+          "camera back",
+          "startVideo 1234",
+          "camera back"}));
+}
+
+TEST_F(CallSessionTest, forwardsStatsOnlyWhileActive) {
+  configure();
+  session_->startCall(CallMedia::Audio, "1234");
+  sdk_->listener().onStats({.quality = CallQuality::Poor});
+  sdk_->listener().onActive();
+  sdk_->listener().onStats(
+      {.quality = CallQuality::Good, .roundTripTimeMilliseconds = 80});
+
+  ASSERT_EQ(events_.size(), 3u);
+  EXPECT_EQ(events_[2].type, CallEvent::Type::Stats);
+  EXPECT_EQ(events_[2].stats.quality, CallQuality::Good);
+  EXPECT_EQ(events_[2].stats.roundTripTimeMilliseconds, 80u);
+}
+
+TEST_F(CallSessionTest, parsesDtmfTones) {
+  EXPECT_EQ(CallSession::parseDtmfTone("0"), DtmfTone::Zero);
+  EXPECT_EQ(CallSession::parseDtmfTone("9"), DtmfTone::Nine);
+  EXPECT_EQ(CallSession::parseDtmfTone("*"), DtmfTone::Star);
+  EXPECT_EQ(CallSession::parseDtmfTone("#"), DtmfTone::Pound);
+  EXPECT_EQ(CallSession::parseDtmfTone("d"), DtmfTone::D);
+  EXPECT_EQ(CallSession::parseDtmfTone(""), std::nullopt);
+  EXPECT_EQ(CallSession::parseDtmfTone("x"), std::nullopt);
+}
+
+TEST(CallEventTest, mapsStatesToCallStatuses) {
+  EXPECT_EQ(toCallStatus(CallState::Idle), nullptr);
+  EXPECT_STREQ(toCallStatus(CallState::Initiating), "initiating");
+  EXPECT_STREQ(toCallStatus(CallState::RemoteAlerting), "ringing");
+  EXPECT_STREQ(toCallStatus(CallState::Active), "connected");
+  EXPECT_EQ(toCallStatus(CallState::Ending), nullptr);
+  EXPECT_STREQ(toCallStatus(CallState::Ended), "ended");
+  EXPECT_STREQ(toCallStatus(CallState::Failed), "error");
+}
+
+TEST_F(CallSessionTest, detachesFromTheSdk) {
+  session_.reset();
+  EXPECT_FALSE(sdk_->hasListener());
+}
+
+} // namespace avayawebrtc
@@ -0,0 +1,214 @@
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "../../CallEventQueue.h"
+#include "../../CallSession.h"
+
+namespace avayawebrtc {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*
+ * A serial queue on its own thread, standing in for the main queue and for
+ * the JS thread.
+ */
+class SerialQueue {
+ public:
+  SerialQueue() : thread_([this]() { run(); }) {}
+
+  ~SerialQueue() {
+    post(nullptr);
+    thread_.join();
+  }
+
+  void post(std::function<void()>&& task) {
+    {
+      std::lock_guard lock(mutex_);
+      tasks_.push_back(std::move(task));
+    }
+    condition_.notify_one();
+  }
+
+ private:
+  void run() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock lock(mutex_);
+        condition_.wait(lock, [this]() { return !tasks_.empty(); });
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      if (!task) {
+        return;
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> tasks_;
+  std::thread thread_;
+};
+
+/*
+ * Collects what reached "JS" and lets the SDK thread wait for the last event
+ * of a burst.
+ */
+class Receiver {
+ public:
+  void receive(uint32_t sequence, Clock::time_point postedAt) {
+    auto latency = Clock::now() - postedAt;
+    std::lock_guard lock(mutex_);
+    totalLatency_ += latency;
+    received_++;
+    lastSequence_ = sequence;
+    condition_.notify_one();
+  }
+
+  void waitFor(uint32_t sequence) {
+    std::unique_lock lock(mutex_);
+    condition_.wait(lock, [&]() { return lastSequence_ == sequence; });
+  }
+
+  double averageLatencyMicroseconds() const {
+    return received_ == 0
+        ? 0.0
+        : std::chrono::duration<double, std::micro>(totalLatency_).count() /
+            static_cast<double>(received_);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  Clock::duration totalLatency_{};
+  size_t received_{0};
+  uint32_t lastSequence_{0};
+};
+
+using Dictionary = std::unordered_map<std::string, std::string>;
+
+/*
+ * The path of the platform modules: the SDK reports on the main queue, each
+ * event becomes a dictionary, `sendCallEventToReact` hops to the main queue
+ * once more, and the bridge then hops to the JS thread.
+ */
+void legacyPath(benchmark::State& state) {
+  const auto burstSize = static_cast<uint32_t>(state.range(0));
+  SerialQueue mainQueue;
+  SerialQueue jsThread;
+  Receiver receiver;
+
+  auto emit = [&](uint32_t sequence, Clock::time_point postedAt) {
+    mainQueue.post([&, sequence, postedAt]() {
+      auto body = std::make_shared<Dictionary>(Dictionary{
+          {"status", "connected"}, {"sequence", std::to_string(sequence)}});
+      mainQueue.post([&, body, postedAt]() {
+        auto converted = std::make_shared<Dictionary>(*body);
+        jsThread.post([&, converted, postedAt]() {
+          receiver.receive(
+              static_cast<uint32_t>(std::stoul(converted->at("sequence"))),
+              postedAt);
+        });
+      });
+    });
+  };
+
+  uint32_t sequence = 0;
+  for (auto _ : state) {
+    for (uint32_t i = 0; i < burstSize; i++) {
+      emit(++sequence, Clock::now());
+    }
+    receiver.waitFor(sequence);
+  }
+  state.counters["latencyUs"] = receiver.averageLatencyMicroseconds();
+}
+
+class StatsSdk : public MediaSdk {
+ public:
+  void setListener(MediaSdkListener* listener) override {
+    listener_ = listener;
+  }
+  void configure(const MediaSdkConfiguration& /*configuration*/) override {}
+  void startCall(CallMedia /*media*/, const std::string& /*destination*/)
+      override {}
+  void endCall() override {}
+  void setAudioMuted(bool /*muted*/) override {}
+  void setVideoEnabled(bool /*enabled*/) override {}
+  void selectCamera(Camera /*camera*/) override {}
+  void sendDtmf(DtmfTone /*tone*/) override {}
+
+  MediaSdkListener& listener() {
+    return *listener_;
+  }
+
+ private:
+  MediaSdkListener* listener_{nullptr};
+};
+
+/*
+ * The path of `NativeCallSessionModule`: the session queues plain events on
+ * the SDK's thread and the first event of a burst schedules one drain on the
+ * JS thread. Stats of a burst collapse into the latest one.
+ */
+void sessionPath(benchmark::State& state) {
+  const auto burstSize = static_cast<uint32_t>(state.range(0));
+  SerialQueue jsThread;
+  Receiver receiver;
+  CallEventQueue queue;
+  std::vector<CallEvent> events;
+  std::vector<Clock::time_point> postedAt(burstSize * 2);
+
+  auto sdk = std::make_shared<StatsSdk>();
+  CallSession session(sdk, [&](CallEvent&& event) {
+    if (queue.push(std::move(event))) {
+      jsThread.post([&]() {
+        queue.drain(events);
+        for (const auto& event : events) {
+          if (event.type != CallEvent::Type::Stats) {
+            continue;
+          }
+          auto sequence = event.stats.packetsReceived;
+          receiver.receive(sequence, postedAt[sequence % postedAt.size()]);
+        }
+        events.clear();
+      });
+    }
+  });
+  session.configure({.token = "token"});
+  session.startCall(CallMedia::Audio, "1234");
+  sdk->listener().onActive();
+
+  uint32_t sequence = 0;
+  for (auto _ : state) {
+    for (uint32_t i = 0; i < burstSize; i++) {
+      sequence++;
+      postedAt[sequence % postedAt.size()] = Clock::now();
+      sdk->listener().onStats({.packetsReceived = sequence});
+    }
+    receiver.waitFor(sequence);
+  }
+  state.counters["latencyUs"] = receiver.averageLatencyMicroseconds();
+}
+
+} // namespace
+
+BENCHMARK(legacyPath)->ArgName("burst")->Arg(1)->Arg(16)->UseRealTime();
+BENCHMARK(sessionPath)->ArgName("burst")->Arg(1)->Arg(16)->UseRealTime();
+
+} // namespace avayawebrtc
+
+BENCHMARK_MAIN();
@@ -0,0 +1,43 @@
+#import <Foundation/Foundation.h>
+
+#include <memory>
+
+#include "MediaSdk.h"
+
+@class AvayaMediaSdkDelegate;
+@class UIView;
+
+namespace avayawebrtc {
+
+/**
+ * `MediaSdk` on top of the Oceana Customer Web Voice Video SDK, for the
+ * shared `CallSession`. Commands run on the main queue, where the SDK and the
+ * views it renders in must be used.
+ */
+class AvayaMediaSdk : public MediaSdk {
+ public:
+  AvayaMediaSdk();
+  ~AvayaMediaSdk() override;
+
+  void setListener(MediaSdkListener *listener) override;
+  void configure(const MediaSdkConfiguration &configuration) override;
+  void startCall(CallMedia media, const std::string &destination) override;
+  void endCall() override;
+  void setAudioMuted(bool muted) override;
+  void setVideoEnabled(bool enabled) override;
+  void selectCamera(Camera camera) override;
+  void sendDtmf(DtmfTone tone) override;
+
+  /**
+   * Sets the views video calls render the local camera and the remote party
+   * in, for the calls of every `AvayaMediaSdk`, as there is a single camera
+   * to show. The views are not retained. Must be called on the main queue.
+   */
+  static void setLocalView(UIView *view);
+  static void setRemoteView(UIView *view);
+
+ private:
+  AvayaMediaSdkDelegate *delegate_;
+};
+
+} // namespace avayawebrtc
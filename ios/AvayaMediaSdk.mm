@@ -0,0 +1,427 @@
+#import "AvayaMediaSdk.h"
+
+#import <UIKit/UIKit.h>
+
+#import <OceanaCustomerWebVoiceVideo/AOAudioInteraction.h>
+#import <OceanaCustomerWebVoiceVideo/AOClientConfiguration.h>
+#import <OceanaCustomerWebVoiceVideo/AOConnectionListener.h>
+#import <OceanaCustomerWebVoiceVideo/AOOceanaCustomerWebVoiceVideo.h>
+#import <OceanaCustomerWebVoiceVideo/AOVideoDevice.h>
+#import <OceanaCustomerWebVoiceVideo/AOVideoInteraction.h>
+#import <OceanaCustomerWebVoiceVideo/AOWork.h>
+
+#include <atomic>
+#include <mutex>
+
+using namespace avayawebrtc;
+
+static CallQuality toCallQuality(AOCallQuality quality)
+{
+  switch (quality) {
+    case AOCallQualityBad:
+      return CallQuality::Bad;
+    case AOCallQualityPoor:
+      return CallQuality::Poor;
+    case AOCallQualityFair:
+      return CallQuality::Fair;
+    case AOCallQualityGood:
+      return CallQuality::Good;
+    case AOCallQualityExcellent:
+      return CallQuality::Excellent;
+  }
+  return CallQuality::Unknown;
+}
+
+static std::string describe(NSException *exception)
+{
+  NSString *reason = exception.reason ?: exception.name;
+  return reason.UTF8String ?: "";
+}
+
+/**
+ * The views video calls render in, shared by every SDK. Only used on the main
+ * queue.
+ */
+@interface AvayaVideoViews : NSObject
+
+@property (nonatomic, weak) UIView *localView;
+@property (nonatomic, weak) UIView *remoteView;
+@property (nonatomic, readonly) NSHashTable<AvayaMediaSdkDelegate *> *delegates;
+
++ (instancetype)shared;
+
+@end
+
+/**
+ * Owns the SDK objects and forwards their delegate callbacks to the
+ * `MediaSdkListener`. The SDK objects are only used on the main queue.
+ */
+@interface AvayaMediaSdkDelegate
+    : NSObject <AOAudioInteractionDelegate, AOVideoInteractionDelegate, AOConnectionListenerDelegate>
+
+@property (nonatomic, strong) AOOceanaCustomerWebVoiceVideo *sdk;
+@property (nonatomic, strong) NSString *token;
+@property (nonatomic, strong) AOAudioInteraction *audioInteraction;
+@property (nonatomic, strong) AOVideoInteraction *videoInteraction;
+
+- (void)setListener:(MediaSdkListener *)listener;
+- (void)detach;
+- (void)runOnMainQueue:(void (^)(void))call;
+- (void)failWithReason:(const std::string &)reason;
+- (void)attachViews;
+
+@end
+
+@implementation AvayaVideoViews
+
++ (instancetype)shared
+{
+  static AvayaVideoViews *views;
+  static dispatch_once_t once;
+  dispatch_once(&once, ^{
+    views = [AvayaVideoViews new];
+  });
+  return views;
+}
+
+- (instancetype)init
+{
+  if (self = [super init]) {
+    _delegates = [NSHashTable weakObjectsHashTable];
+  }
+  return self;
+}
+
+@end
+
+@implementation AvayaMediaSdkDelegate {
+  // Held while calling the listener, so that detaching it waits for the
+  // callback in progress.
+  std::mutex _listenerMutex;
+  MediaSdkListener *_listener;
+  // Set once the `AvayaMediaSdk` is gone, so that its queued commands are
+  // dropped.
+  std::atomic<bool> _detached;
+}
+
+- (void)setListener:(MediaSdkListener *)listener
+{
+  std::lock_guard<std::mutex> lock(_listenerMutex);
+  _listener = listener;
+}
+
+- (void)notify:(void (^)(MediaSdkListener &listener))callback
+{
+  std::lock_guard<std::mutex> lock(_listenerMutex);
+  if (_listener) {
+    callback(*_listener);
+  }
+}
+
+- (void)detach
+{
+  [self setListener:nullptr];
+  _detached = true;
+  dispatch_async(dispatch_get_main_queue(), ^{
+    self.audioInteraction.delegate = nil;
+    self.audioInteraction.connectionListenerDelegate = nil;
+    self.videoInteraction.delegate = nil;
+    self.videoInteraction.connectionListenerDelegate = nil;
+    [[AvayaVideoViews shared].delegates removeObject:self];
+  });
+}
+
+- (void)runOnMainQueue:(void (^)(void))call
+{
+  dispatch_async(dispatch_get_main_queue(), ^{
+    if (self->_detached) {
+      return;
+    }
+    @try {
+      call();
+    } @catch (NSException *exception) {
+      NSLog(@"[AvayaMediaSdk] %@", exception.reason ?: exception.name);
+    }
+  });
+}
+
+- (void)failWithReason:(const std::string &)reason
+{
+  [self notify:^(MediaSdkListener &listener) {
+    listener.onFailed(reason);
+  }];
+}
+
+- (void)attachViews
+{
+  AOVideoDevice *device = self.videoInteraction.videoDevice;
+  AvayaVideoViews *views = [AvayaVideoViews shared];
+  if (device && views.localView) {
+    [device setLocalView:views.localView];
+  }
+  if (device && views.remoteView) {
+    [device setRemoteView:views.remoteView];
+  }
+}
+
+- (void)interactionInitiating
+{
+  [self notify:^(MediaSdkListener &listener) {
+    listener.onInitiating();
+  }];
+}
+
+- (void)interactionRemoteAlerting
+{
+  [self notify:^(MediaSdkListener &listener) {
+    listener.onRemoteAlerting();
+  }];
+}
+
+- (void)interactionActive
+{
+  // The SDK only renders in views set once the call is up.
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [self attachViews];
+  });
+  [self notify:^(MediaSdkListener &listener) {
+    listener.onActive();
+  }];
+}
+
+- (void)interactionEnded
+{
+  self.audioInteraction = nil;
+  self.videoInteraction = nil;
+  [self notify:^(MediaSdkListener &listener) {
+    listener.onEnded();
+  }];
+}
+
+- (void)interactionFailed:(NSError *)error
+{
+  self.audioInteraction = nil;
+  self.videoInteraction = nil;
+  [self failWithReason:error.localizedDescription.UTF8String ?: ""];
+}
+
+- (void)interactionServiceDisconnectedWithError:(NSError *)error
+{
+  [self failWithReason:error.localizedDescription.UTF8String ?: ""];
+}
+
+- (void)onInteractionQualityChanged:(AOCallQuality)quality
+{
+  void (^report)(AOAudioDetails *) = ^(AOAudioDetails *details) {
+    CallStats stats{.quality = toCallQuality(quality)};
+    if (details) {
+      stats.packetsSent = static_cast<uint32_t>(details.packetsTransmitted);
+      stats.packetsReceived = static_cast<uint32_t>(details.packetsReceived);
+      stats.packetLossPercent = static_cast<uint32_t>(details.currentPacketLossRate);
+      stats.jitterMilliseconds = static_cast<uint32_t>(details.averageJitterReceivedMilliseconds);
+      stats.roundTripTimeMilliseconds = static_cast<uint32_t>(details.roundTripTimeMilliseconds);
+    }
+    [self notify:^(MediaSdkListener &listener) {
+      listener.onStats(stats);
+    }];
+  };
+  if (self.videoInteraction) {
+    [self.videoInteraction readAudioDetailsWithCompletionHandler:report];
+  } else if (self.audioInteraction) {
+    [self.audioInteraction readAudioDetailsWithCompletionHandler:report];
+  } else {
+    report(nil);
+  }
+}
+
+- (void)interactionAudioMuteStatusChanged:(BOOL)isMuted {}
+- (void)interactionVideoMuteStatusChanged:(BOOL)isMuted {}
+- (void)interactionVideoEnabledStatusChanged:(BOOL)isEnabled {}
+- (void)discardComplete {}
+- (void)holdComplete {}
+- (void)unholdComplete {}
+- (void)remoteHoldComplete {}
+- (void)remoteUnholdComplete {}
+- (void)onInteractionVideoMuteStatusChanged:(BOOL)state {}
+- (void)onInteractionVideoDisabledBelowThreshold:(AOCallQuality)quality {}
+- (void)onInteractionVideoCanBeEnabledThresholdCrossed:(AOCallQuality)quality {}
+- (void)interactionServiceConnecting {}
+- (void)interactionServiceConnected {}
+
+@end
+
+namespace avayawebrtc {
+
+AvayaMediaSdk::AvayaMediaSdk() : delegate_([AvayaMediaSdkDelegate new])
+{
+  AvayaMediaSdkDelegate *delegate = delegate_;
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [[AvayaVideoViews shared].delegates addObject:delegate];
+  });
+}
+
+AvayaMediaSdk::~AvayaMediaSdk()
+{
+  [delegate_ detach];
+}
+
+void AvayaMediaSdk::setListener(MediaSdkListener *listener)
+{
+  [delegate_ setListener:listener];
+}
+
+void AvayaMediaSdk::configure(const MediaSdkConfiguration &configuration)
+{
+  AvayaMediaSdkDelegate *delegate = delegate_;
+  NSString *address = configuration.gatewayAddress.empty() ? @"sipsignal.whnmandiri.co.id"
+                                                           : @(configuration.gatewayAddress.c_str());
+  NSString *port = configuration.gatewayPort.empty() ? @"443" : @(configuration.gatewayPort.c_str());
+  NSString *urlPath = configuration.gatewayUrlPath.empty() ? @"csa/resources/tenants/default"
+                                                           : @(configuration.gatewayUrlPath.c_str());
+  NSString *token = @(configuration.token.c_str());
+  [delegate runOnMainQueue:^{
+    delegate.sdk = nil;
+    delegate.token = token;
+
+    AOWebGatewayConfiguration *webConfig = [[AOWebGatewayConfiguration alloc] init];
+    webConfig.webGatewayAddress = address;
+    webConfig.port = port;
+    webConfig.isSecure = YES;
+    webConfig.webGatewayUrlPath = urlPath;
+
+    AOClientConfiguration *clientConfig = [[AOClientConfiguration alloc] init];
+    clientConfig.webGatewayConfiguration = webConfig;
+    clientConfig.configuration = nil;
+
+    delegate.sdk = [[AOOceanaCustomerWebVoiceVideo alloc] initWithClientConfiguration:clientConfig];
+  }];
+}
+
+void AvayaMediaSdk::startCall(CallMedia media, const std::string &destination)
+{
+  AvayaMediaSdkDelegate *delegate = delegate_;
+  NSString *destinationAddress = @(destination.c_str());
+  [delegate runOnMainQueue:^{
+    // Callbacks of earlier calls must not end this one.
+    delegate.audioInteraction.delegate = nil;
+    delegate.videoInteraction.delegate = nil;
+    delegate.audioInteraction = nil;
+    delegate.videoInteraction = nil;
+
+    std::string failure;
+    @try {
+      AOWork *work = [delegate.sdk createWork];
+      if (!work) {
+        failure = "The SDK is not configured";
+      } else if (media == CallMedia::Video) {
+        AOVideoInteraction *interaction = [work createVideoInteraction];
+        interaction.delegate = delegate;
+        interaction.connectionListenerDelegate = delegate;
+        interaction.authorizationToken = delegate.token;
+        [interaction setPlatformType:AOPlatFormType_ELITE];
+
+        AOVideoDevice *device = interaction.videoDevice;
+        [device setVideoCaptureResolutionWithCaptureOrientation:AOVideoCapturePreference_Min
+                                          orientationPreference:AOVideoCaptureOrientation_LandscapeOnly];
+        [device selectCamera:AOCameraTypeFront];
+        [interaction muteVideo:NO];
+        delegate.videoInteraction = interaction;
+        [delegate attachViews];
+
+        interaction.destinationAddress = destinationAddress;
+        [interaction enableVideo:YES];
+        [interaction start];
+      } else {
+        AOAudioInteraction *interaction = [work createAudioInteraction];
+        interaction.delegate = delegate;
+        interaction.connectionListenerDelegate = delegate;
+        interaction.authorizationToken = delegate.token;
+        [interaction setPlatformType:AOPlatFormType_ELITE];
+        interaction.destinationAddress = destinationAddress;
+        delegate.audioInteraction = interaction;
+        [interaction start];
+      }
+    } @catch (NSException *exception) {
+      delegate.audioInteraction = nil;
+      delegate.videoInteraction = nil;
+      failure = describe(exception);
+    }
+    if (!failure.empty()) {
+      [delegate failWithReason:failure];
+    }
+  }];
+}
+
+void AvayaMediaSdk::endCall()
+{
+  AvayaMediaSdkDelegate *delegate = delegate_;
+  [delegate runOnMainQueue:^{
+    if (!delegate.audioInteraction && !delegate.videoInteraction) {
+      // The call never got an interaction, so nothing else will end it.
+      [delegate interactionEnded];
+      return;
+    }
+    [delegate.audioInteraction end];
+    [delegate.videoInteraction end];
+  }];
+}
+
+void AvayaMediaSdk::setAudioMuted(bool muted)
+{
+  AvayaMediaSdkDelegate *delegate = delegate_;
+  [delegate runOnMainQueue:^{
+    [delegate.audioInteraction muteAudio:muted];
+    [delegate.videoInteraction muteAudio:muted];
+  }];
+}
+
+void AvayaMediaSdk::setVideoEnabled(bool enabled)
+{
+  AvayaMediaSdkDelegate *delegate = delegate_;
+  [delegate runOnMainQueue:^{
+    [delegate.videoInteraction muteVideo:!enabled];
+  }];
+}
+
+void AvayaMediaSdk::selectCamera(Camera camera)
+{
+  AvayaMediaSdkDelegate *delegate = delegate_;
+  AOCameraType cameraType = camera == Camera::Back ? AOCameraTypeBack : AOCameraTypeFront;
+  [delegate runOnMainQueue:^{
+    [delegate.videoInteraction.videoDevice selectCamera:cameraType];
+  }];
+}
+
+void AvayaMediaSdk::sendDtmf(DtmfTone tone)
+{
+  AvayaMediaSdkDelegate *delegate = delegate_;
+  // `DtmfTone` follows the order of `AODTMFTone`.
+  auto sdkTone = static_cast<AODTMFTone>(tone);
+  [delegate runOnMainQueue:^{
+    if (delegate.audioInteraction) {
+      [delegate.audioInteraction sendDTMF:sdkTone];
+    } else {
+      [delegate.videoInteraction sendDTMF:sdkTone];
+    }
+  }];
+}
+
+void AvayaMediaSdk::setLocalView(UIView *view)
+{
+  AvayaVideoViews *views = [AvayaVideoViews shared];
+  views.localView = view;
+  for (AvayaMediaSdkDelegate *delegate in views.delegates) {
+    [delegate attachViews];
+  }
+}
+
+void AvayaMediaSdk::setRemoteView(UIView *view)
+{
+  AvayaVideoViews *views = [AvayaVideoViews shared];
+  views.remoteView = view;
+  for (AvayaMediaSdkDelegate *delegate in views.delegates) {
+    [delegate attachViews];
+  }
+}
+
+} // namespace avayawebrtc
@@ -0,0 +1,10 @@
+#import <Foundation/Foundation.h>
+#import <ReactCommon/RCTTurboModule.h>
+
+/**
+ * Creates the shared C++ `CallSession` TurboModule on top of the Avaya SDK.
+ * Registered through `codegenConfig.ios.modulesProvider` in package.json.
+ */
+@interface CallSessionModuleProvider : NSObject <RCTModuleProvider>
+
+@end
@@ -0,0 +1,15 @@
+#import "CallSessionModuleProvider.h"
+
+#import "AvayaMediaSdk.h"
+#import "NativeCallSessionModule.h"
+
+@implementation CallSessionModuleProvider
+
+- (std::shared_ptr<facebook::react::TurboModule>)getTurboModule:
+    (const facebook::react::ObjCTurboModule::InitParams &)params
+{
+  return std::make_shared<facebook::react::NativeCallSessionModule>(
+      params.jsInvoker, std::make_shared<avayawebrtc::AvayaMediaSdk>());
+}
+
+@end
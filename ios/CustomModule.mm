@@ -0,0 +1,351 @@
+#import "CustomModule.h"
+#import <AVFoundation/AVFoundation.h>
+#import <React/RCTLog.h>
+#import <React/RCTUIManager.h>
+
+#include <memory>
+
+#import "AvayaMediaSdk.h"
+#include "CallSession.h"
+
+using namespace avayawebrtc;
+
+static std::string configString(NSDictionary *config, NSString *key)
+{
+  id value = config[key];
+  if ([value isKindOfClass:[NSNumber class]]) {
+    value = [value stringValue];
+  }
+  if ([value isKindOfClass:[NSString class]]) {
+    return [value UTF8String] ?: "";
+  }
+  return {};
+}
+
+// Runs a command of the call session, rejecting the promise if it fails.
+static BOOL runCommand(RCTPromiseRejectBlock reject, void (^command)(void))
+{
+  try {
+    command();
+    return YES;
+  } catch (const CallSessionError &error) {
+    reject(@(error.code().c_str()), @(error.what()), nil);
+  } catch (const std::exception &error) {
+    reject(@"sdk_error", @(error.what()), nil);
+  }
+  return NO;
+}
+
+@implementation CustomModule
+{
+  BOOL hasListeners;
+  std::unique_ptr<CallSession> _session;
+}
+
+RCT_EXPORT_MODULE();
+
+#pragma mark - React Native Event Emitter
+
+- (NSArray<NSString *> *)supportedEvents {
+  return @[
+    @"interactionInitiating",
+    @"interactionRemoteAlerting",
+    @"interactionActive",
+    @"interactionEnded",
+    @"interactionFailed",
+    @"onCallStateChanged"
+  ];
+}
+
++ (BOOL)requiresMainQueueSetup
+{
+  return YES;
+}
+
+- (void)startObserving {
+  hasListeners = YES;
+}
+
+- (void)stopObserving {
+  hasListeners = NO;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    __weak CustomModule *weakSelf = self;
+    _session = std::make_unique<CallSession>(
+        std::make_shared<AvayaMediaSdk>(), [weakSelf](CallEvent &&event) {
+          [weakSelf sendCallEvent:event];
+        });
+    NSSetUncaughtExceptionHandler(&uncaughtExceptionHandler);
+  }
+  return self;
+}
+
+- (void)dealloc {
+  // Detach from the SDK before the module goes away.
+  _session.reset();
+}
+
+void uncaughtExceptionHandler(NSException *exception) {
+  NSLog(@"❌ Uncaught Exception: %@", exception.reason);
+  NSLog(@"📄 Stack trace: %@", exception.callStackSymbols);
+}
+
+#pragma mark - Request token from server (async with POST)
+
+RCT_EXPORT_METHOD(requestTokenFromServer:(NSString *)use
+                  phoneNumber:(NSString *)phoneNumber
+                  callingNumber:(NSString *)callingNumber
+                  displayName:(NSString *)displayName
+                  expiration:(NSString *)expiration
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  NSString *tokenServerUrl = @"https://sipsignal.whnmandiri.co.id:443/token-generation-service/token/getEncryptedToken";
+  NSURL *url = [NSURL URLWithString:tokenServerUrl];
+  if (!url) {
+    reject(@"bad_url", @"Invalid token server URL", nil);
+    return;
+  }
+
+  NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:url];
+  request.HTTPMethod = @"POST";
+  NSDictionary *body = @{
+    @"use": use ?: @"",
+    @"phoneNumber": phoneNumber ?: @"",
+    @"callingNumber": callingNumber ?: @"",
+    @"displayName": displayName ?: @"",
+    @"expiration": expiration ?: @""
+  };
+
+  NSLog(@"[DEBUG] Request body dictionary: %@", body);
+
+  NSError *jsonErr = nil;
+  NSData *bodyData = [NSJSONSerialization dataWithJSONObject:body options:0 error:&jsonErr];
+  if (jsonErr) {
+    reject(@"json_error", @"Failed to create request body", jsonErr);
+    return;
+  }
+  request.HTTPBody = bodyData;
+  [request setValue:@"application/json" forHTTPHeaderField:@"Content-Type"];
+
+  NSURLSessionDataTask *task = [[NSURLSession sharedSession] dataTaskWithRequest:request
+                                                               completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
+    if (error) {
+      reject(@"network_error", @"Request token failed", error);
+      return;
+    }
+    if ([response isKindOfClass:[NSHTTPURLResponse class]]) {
+      NSHTTPURLResponse *httpResponse = (NSHTTPURLResponse *)response;
+      NSLog(@"[DEBUG] Response status code: %ld", (long)httpResponse.statusCode);
+      NSLog(@"[DEBUG] Response headers: %@", httpResponse.allHeaderFields);
+    }
+    NSString *rawResponse = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+    NSLog(@"[DEBUG] Raw response string: %@", rawResponse);
+
+    if (!data) {
+      reject(@"no_data", @"No data returned from token server", nil);
+      return;
+    }
+    NSError *parseErr = nil;
+    id json = [NSJSONSerialization JSONObjectWithData:data options:0 error:&parseErr];
+    if (parseErr) {
+      // Jika gagal parsing, return string mentah
+      NSString *responseString = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+      resolve(responseString ?: @"");
+      return;
+    }
+    resolve(json);
+  }];
+  [task resume];
+}
+
+#pragma mark - Set OCS Config (Aura Elite)
+RCT_EXPORT_METHOD(setOcsConfig:(NSString *)configJson
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  NSError *error;
+  NSData *data = [configJson dataUsingEncoding:NSUTF8StringEncoding];
+  NSDictionary *config = data ? [NSJSONSerialization JSONObjectWithData:data options:0 error:&error] : nil;
+  if (![config isKindOfClass:[NSDictionary class]]) {
+    reject(@"json_parse_error", @"Failed to parse config JSON", error);
+    return;
+  }
+
+  MediaSdkConfiguration configuration{
+      .token = configString(config, @"token"),
+      .gatewayAddress = configString(config, @"aawg_server"),
+      .gatewayPort = configString(config, @"aawg_port"),
+      .gatewayUrlPath = configString(config, @"aawg_url_path")};
+  if (runCommand(reject, ^{
+        self->_session->configure(configuration);
+      })) {
+    resolve(@(YES));
+  }
+}
+
+#pragma mark - Start Call
+RCT_EXPORT_METHOD(startAudioCall:(NSString *)destination
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  std::string destinationAddress = destination.UTF8String ?: "";
+  if (runCommand(reject, ^{
+        self->_session->startCall(CallMedia::Audio, destinationAddress);
+      })) {
+    resolve(@(YES));
+  }
+}
+
+RCT_EXPORT_METHOD(startVideoCall:(NSString *)destination
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  std::string destinationAddress = destination.UTF8String ?: "";
+  if (runCommand(reject, ^{
+        self->_session->startCall(CallMedia::Video, destinationAddress);
+      })) {
+    resolve(@(YES));
+  }
+}
+
+#pragma mark - Video Views
+// The views are kept for the current and later video calls, whichever module
+// started them, and resolve whether the view was found.
+RCT_EXPORT_METHOD(attachLocalView:(nonnull NSNumber *)reactTag
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  dispatch_async(dispatch_get_main_queue(), ^{
+    UIView *view = [self.bridge.uiManager viewForReactTag:reactTag];
+    AvayaMediaSdk::setLocalView(view);
+    resolve(@(view != nil));
+  });
+}
+
+RCT_EXPORT_METHOD(attachRemoteView:(nonnull NSNumber *)reactTag
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  dispatch_async(dispatch_get_main_queue(), ^{
+    UIView *view = [self.bridge.uiManager viewForReactTag:reactTag];
+    AvayaMediaSdk::setRemoteView(view);
+    resolve(@(view != nil));
+  });
+}
+
+#pragma mark - End Call
+RCT_EXPORT_METHOD(endCall:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  __block bool ended = false;
+  if (runCommand(reject, ^{
+        ended = self->_session->endCall();
+      })) {
+    resolve(@(ended));
+  }
+}
+
+#pragma mark - Toggle Mute
+RCT_EXPORT_METHOD(toggleMute:(BOOL)mute
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  if (runCommand(reject, ^{
+        self->_session->setAudioMuted(mute);
+      })) {
+    resolve(@(YES));
+  }
+}
+
+#pragma mark - Toggle Speaker
+RCT_EXPORT_METHOD(toggleSpeaker:(BOOL)enable
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  @try {
+    AVAudioSession *session = [AVAudioSession sharedInstance];
+    [session setCategory:AVAudioSessionCategoryPlayAndRecord
+             withOptions:enable ? AVAudioSessionCategoryOptionDefaultToSpeaker : 0
+                   error:nil];
+    [session setActive:YES error:nil];
+    resolve(@(YES));
+  }
+  @catch (NSException *e) {
+    reject(@"SPEAKER_ERROR", e.reason, nil);
+  }
+}
+
+#pragma mark - Toggle Camera
+RCT_EXPORT_METHOD(toggleCamera:(BOOL)enable
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  if (runCommand(reject, ^{
+        self->_session->setVideoEnabled(enable);
+      })) {
+    resolve(@(enable));
+  }
+}
+
+#pragma mark - Switch Camera
+RCT_EXPORT_METHOD(switchCamera:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  if (runCommand(reject, ^{
+        self->_session->switchCamera();
+      })) {
+    resolve(@"Camera switched");
+  }
+}
+
+#pragma mark - Send DTMF
+RCT_EXPORT_METHOD(sendDtmf:(NSString *)digit
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+{
+  std::string tone = digit.UTF8String ?: "";
+  if (runCommand(reject, ^{
+        self->_session->sendDtmf(tone);
+      })) {
+    resolve([NSString stringWithFormat:@"DTMF sent: %@", digit]);
+  }
+}
+
+#pragma mark - Call Events
+
+// Called from whichever thread changed the call; sendEventWithName: is
+// thread-safe, and an extra hop to the main queue would only delay events.
+- (void)sendCallEvent:(const CallEvent &)event {
+  if (!hasListeners || event.type != CallEvent::Type::StateChanged) {
+    return;
+  }
+  switch (event.state) {
+    case CallState::Initiating:
+      [self sendEventWithName:@"interactionInitiating" body:@{}];
+      break;
+    case CallState::RemoteAlerting:
+      [self sendEventWithName:@"interactionRemoteAlerting" body:@{}];
+      break;
+    case CallState::Active:
+      [self sendEventWithName:@"interactionActive" body:@{}];
+      break;
+    case CallState::Ended:
+      [self sendEventWithName:@"interactionEnded" body:@{}];
+      break;
+    case CallState::Failed:
+      [self sendEventWithName:@"interactionFailed" body:@{@"error": @(event.error.c_str())}];
+      break;
+    case CallState::Idle:
+    case CallState::Ending:
+      break;
+  }
+  if (const char *status = toCallStatus(event.state)) {
+    [self sendEventWithName:@"onCallStateChanged" body:@{@"status": @(status)}];
+  }
+}
+
+@end
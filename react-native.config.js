@@ -0,0 +1,12 @@
+module.exports = {
+  dependency: {
+    platforms: {
+      android: {
+        // The shared C++ `CallSession` TurboModule.
+        cxxModuleCMakeListsPath: 'cpp/CMakeLists.txt',
+        cxxModuleCMakeListsModuleName: 'avayawebrtc_callsession',
+        cxxModuleHeaderName: 'NativeCallSessionModule',
+      },
+    },
+  },
+};
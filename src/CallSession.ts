@@ -0,0 +1,48 @@
+import { TurboModuleRegistry, type TurboModule } from 'react-native';
+
+export type CallState =
+  | 'idle'
+  | 'initiating'
+  | 'remoteAlerting'
+  | 'active'
+  | 'ending'
+  | 'ended'
+  | 'failed';
+
+export type CallEvent =
+  | { type: 'state'; state: CallState; error?: string }
+  | {
+      type: 'stats';
+      state: CallState;
+      quality: 'unknown' | 'bad' | 'poor' | 'fair' | 'good' | 'excellent';
+      packetsSent: number;
+      packetsReceived: number;
+      packetLossPercent: number;
+      jitterMs: number;
+      roundTripTimeMs: number;
+    };
+
+export type CallConfiguration = {
+  token: string;
+  aawg_server?: string;
+  aawg_port?: string;
+  aawg_url_path?: string;
+};
+
+// Implemented in C++ (cpp/NativeCallSessionModule.h) for both platforms, so
+// this file is not a codegen spec. Refused commands throw an Error with a
+// `code`.
+export interface Spec extends TurboModule {
+  configure(config: CallConfiguration): void;
+  startAudioCall(destination: string): void;
+  startVideoCall(destination: string): void;
+  endCall(): boolean;
+  setAudioMuted(muted: boolean): void;
+  setVideoEnabled(enabled: boolean): void;
+  switchCamera(): 'front' | 'back';
+  sendDtmf(digit: string): void;
+  getState(): CallState;
+  setListener(listener: ((event: CallEvent) => void) | null): void;
+}
+
+export default TurboModuleRegistry.get<Spec>('CallSession');
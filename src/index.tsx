@@ -1,2 +1,8 @@
 import { NativeModules } from 'react-native';
 export const { CustomModule } = NativeModules;
+export { default as CallSession } from './CallSession';
+export type {
+  CallEvent,
+  CallState,
+  CallConfiguration,
+} from './CallSession';